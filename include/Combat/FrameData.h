@@ -0,0 +1,330 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "raylib.h"
+
+/**
+ * Compile-time frame data: fighter stats, moves and weapons.
+ *
+ * Everything here is `constexpr` and validated with `static_assert` at the bottom of
+ * the file, so a broken table fails the build instead of a fight. Frames are simulation
+ * ticks. Boxes are offsets from the fighter's top-left corner with the fighter facing
+ * right; callers mirror them for fighters facing left.
+ *
+ * Moves are authored as short segments (a run of frames sharing one set of boxes) and
+ * expanded at compile time into one MoveFrame per frame, so looking up the boxes of a
+ * move's Nth frame is two table indexings.
+ */
+namespace FrameData
+{
+	enum class FighterId : uint8_t
+	{
+		Player,
+		Enemy,
+		Count
+	};
+
+	enum class MoveId : uint8_t
+	{
+		Shot, // Player's ranged attack: spawns a projectile on its active frame
+		Jab, // Bare-handed melee
+		KnifeSlash,
+		BottleStab,
+		Count
+	};
+
+	enum class WeaponId : uint8_t
+	{
+		Fists,
+		Knife,
+		BrokenBottle,
+		Count
+	};
+
+	constexpr size_t FighterCount = static_cast<size_t>(FighterId::Count);
+	constexpr size_t MoveCount = static_cast<size_t>(MoveId::Count);
+	constexpr size_t WeaponCount = static_cast<size_t>(WeaponId::Count);
+
+	/**
+	 * Range of boxes in the Boxes table.
+	 */
+	struct BoxRange
+	{
+		uint16_t first;
+		uint16_t count;
+	};
+
+	/**
+	 * Boxes of one frame of a move.
+	 */
+	struct MoveFrame
+	{
+		BoxRange hit; // Deal damage to hurtboxes of the other side
+		BoxRange hurt; // Where the attacker can be hit during the frame
+	};
+
+	/**
+	 * A run of `frames` consecutive frames sharing the same boxes, as authored.
+	 */
+	struct Segment
+	{
+		uint8_t frames;
+		MoveFrame boxes;
+	};
+
+	struct Move
+	{
+		uint8_t startup; // Frames before the first active frame
+		uint8_t active; // Frames that can hit
+		uint8_t recovery; // Frames after the last active frame before the fighter can act again
+		float damage; // Per hit
+		Vector2 velocity; // Of the projectile, facing right; zero for melee moves
+		uint32_t lifetime; // Ticks a projectile lives; zero for melee moves
+		uint16_t firstSegment;
+		uint16_t segmentCount;
+
+		constexpr uint32_t TotalFrames() const { return uint32_t{ startup } + active + recovery; }
+		constexpr bool IsProjectile() const { return lifetime > 0; }
+	};
+
+	struct Fighter
+	{
+		float hp;
+		float walkSpeed; // Units per second
+		BoxRange hurt; // Hurtboxes while not attacking
+	};
+
+	struct Weapon
+	{
+		MoveId melee; // Move the weapon's attack button performs
+	};
+
+	// Box table, in pixels relative to a 60x83 fighter facing right
+	inline constexpr Rectangle Boxes[] =
+	{
+		{ 10, 4, 40, 79 }, // 0: body
+		{ 40, 26, 22, 14 }, // 1: jab arm
+		{ 50, 26, 24, 14 }, // 2: jab fist
+		{ 10, 4, 40, 79 }, // 3: body
+		{ 40, 20, 26, 14 }, // 4: slash arm
+		{ 48, 10, 40, 44 }, // 5: knife arc
+		{ 10, 4, 40, 79 }, // 6: body
+		{ 40, 28, 24, 14 }, // 7: stab arm
+		{ 50, 30, 34, 12 }, // 8: bottle tip
+	};
+
+	constexpr BoxRange NoBoxes = { 0, 0 };
+	constexpr BoxRange Body = { 0, 1 };
+
+	inline constexpr Segment Segments[] =
+	{
+		// Shot
+		{ 1, { NoBoxes, Body } },
+		// Jab
+		{ 4, { NoBoxes, Body } },
+		{ 3, { { 2, 1 }, { 0, 2 } } },
+		{ 8, { NoBoxes, { 0, 2 } } },
+		// KnifeSlash
+		{ 5, { NoBoxes, { 3, 1 } } },
+		{ 4, { { 5, 1 }, { 3, 2 } } },
+		{ 10, { NoBoxes, { 3, 1 } } },
+		// BottleStab
+		{ 6, { NoBoxes, { 6, 1 } } },
+		{ 2, { { 8, 1 }, { 6, 2 } } },
+		{ 12, { NoBoxes, { 6, 2 } } },
+	};
+
+	// Indexed by MoveId
+	inline constexpr Move Moves[] =
+	{
+		//  S  A   R  damage  velocity        lifetime  segments
+		{ 0, 1, 0, 30.f, { 1000.f, 0 }, 720, 0, 1 }, // Shot
+		{ 4, 3, 8, 20.f, { 0, 0 }, 0, 1, 3 }, // Jab
+		{ 5, 4, 10, 45.f, { 0, 0 }, 0, 4, 3 }, // KnifeSlash
+		{ 6, 2, 12, 60.f, { 0, 0 }, 0, 7, 3 }, // BottleStab
+	};
+
+	// Indexed by FighterId
+	inline constexpr Fighter Fighters[] =
+	{
+		{ 300.f, 100.f, Body }, // Player
+		{ 100.f, 80.f, Body }, // Enemy
+	};
+
+	// Indexed by WeaponId
+	inline constexpr Weapon Weapons[] =
+	{
+		{ MoveId::Jab }, // Fists
+		{ MoveId::KnifeSlash }, // Knife
+		{ MoveId::BottleStab }, // BrokenBottle
+	};
+
+	/**
+	 * Frames of every move, back to back in MoveId order.
+	 */
+	constexpr size_t CountFrames()
+	{
+		size_t total = 0;
+		for (const Move& move : Moves)
+			total += move.TotalFrames();
+		return total;
+	}
+
+	/**
+	 * Expand the authored segments into one MoveFrame per frame.
+	 */
+	constexpr std::array<MoveFrame, CountFrames()> ExpandFrames()
+	{
+		std::array<MoveFrame, CountFrames()> frames{};
+		size_t next = 0;
+		for (const Move& move : Moves)
+		{
+			for (uint16_t s = move.firstSegment; s < move.firstSegment + move.segmentCount; s++)
+			{
+				for (uint8_t i = 0; i < Segments[s].frames; i++)
+					frames[next++] = Segments[s].boxes;
+			}
+		}
+		return frames;
+	}
+
+	/**
+	 * Index of each move's first frame in Frames.
+	 */
+	constexpr std::array<uint16_t, MoveCount> FirstFrames()
+	{
+		std::array<uint16_t, MoveCount> first{};
+		uint16_t next = 0;
+		for (size_t i = 0; i < MoveCount; i++)
+		{
+			first[i] = next;
+			next = static_cast<uint16_t>(next + Moves[i].TotalFrames());
+		}
+		return first;
+	}
+
+	inline constexpr std::array<MoveFrame, CountFrames()> Frames = ExpandFrames();
+	inline constexpr std::array<uint16_t, MoveCount> MoveFirstFrame = FirstFrames();
+
+	/**
+	 * A list of boxes straight out of the Boxes table.
+	 */
+	struct BoxList
+	{
+		const Rectangle* first;
+		uint16_t count;
+
+		constexpr const Rectangle* begin() const { return first; }
+		constexpr const Rectangle* end() const { return first + count; }
+		constexpr bool empty() const { return count == 0; }
+	};
+
+	constexpr const Move& GetMove(MoveId id) { return Moves[static_cast<size_t>(id)]; }
+	constexpr const Fighter& GetFighter(FighterId id) { return Fighters[static_cast<size_t>(id)]; }
+	constexpr const Weapon& GetWeapon(WeaponId id) { return Weapons[static_cast<size_t>(id)]; }
+	constexpr BoxList GetBoxes(BoxRange range) { return { Boxes + range.first, range.count }; }
+
+	/**
+	 * Boxes of a move's frame.
+	 * @param id Move being performed.
+	 * @param frame Frame of the move, from 0; must be below its TotalFrames.
+	 */
+	constexpr const MoveFrame& GetFrame(MoveId id, uint32_t frame)
+	{
+		return Frames[MoveFirstFrame[static_cast<size_t>(id)] + frame];
+	}
+
+	// Validation
+
+	constexpr bool RangeInTable(BoxRange range)
+	{
+		return range.first + range.count <= sizeof(Boxes) / sizeof(Boxes[0]);
+	}
+
+	constexpr bool SegmentsValid()
+	{
+		for (const Segment& segment : Segments)
+		{
+			if (segment.frames == 0 || !RangeInTable(segment.boxes.hit) || !RangeInTable(segment.boxes.hurt))
+				return false;
+		}
+		return true;
+	}
+
+	constexpr bool MovesValid()
+	{
+		size_t nextSegment = 0;
+		for (size_t i = 0; i < MoveCount; i++)
+		{
+			const Move& move = Moves[i];
+			if (move.firstSegment != nextSegment || move.active == 0 || move.damage <= 0)
+				return false;
+			nextSegment += move.segmentCount;
+			if (nextSegment > sizeof(Segments) / sizeof(Segments[0]))
+				return false;
+
+			// Segments cover the move exactly, and hitboxes only appear on active frames
+			uint32_t frame = 0;
+			for (uint16_t s = move.firstSegment; s < move.firstSegment + move.segmentCount; s++)
+			{
+				const Segment& segment = Segments[s];
+				const bool active = frame >= move.startup && frame + segment.frames <= uint32_t{ move.startup } + move.active;
+				if (segment.boxes.hit.count > 0 && !active)
+					return false;
+				frame += segment.frames;
+			}
+			if (frame != move.TotalFrames())
+				return false;
+
+			// Projectiles fly and carry no melee boxes; melee moves hit on their active frames
+			if (move.IsProjectile() != (move.velocity.x != 0 || move.velocity.y != 0))
+				return false;
+		}
+		return nextSegment == sizeof(Segments) / sizeof(Segments[0]);
+	}
+
+	constexpr bool MeleeHasHitboxes()
+	{
+		for (size_t i = 0; i < MoveCount; i++)
+		{
+			const Move& move = Moves[i];
+			bool hits = false;
+			for (uint32_t frame = 0; frame < move.TotalFrames(); frame++)
+				hits = hits || GetFrame(static_cast<MoveId>(i), frame).hit.count > 0;
+			if (hits == move.IsProjectile())
+				return false;
+		}
+		return true;
+	}
+
+	constexpr bool WeaponsAreMelee()
+	{
+		for (const Weapon& weapon : Weapons)
+		{
+			if (GetMove(weapon.melee).IsProjectile())
+				return false;
+		}
+		return true;
+	}
+
+	constexpr bool FightersValid()
+	{
+		for (const Fighter& fighter : Fighters)
+		{
+			if (fighter.hp <= 0 || fighter.walkSpeed < 0 || fighter.hurt.count == 0 || !RangeInTable(fighter.hurt))
+				return false;
+		}
+		return true;
+	}
+
+	static_assert(sizeof(Moves) / sizeof(Moves[0]) == MoveCount, "Moves must have one entry per MoveId");
+	static_assert(sizeof(Fighters) / sizeof(Fighters[0]) == FighterCount, "Fighters must have one entry per FighterId");
+	static_assert(sizeof(Weapons) / sizeof(Weapons[0]) == WeaponCount, "Weapons must have one entry per WeaponId");
+	static_assert(SegmentsValid(), "Every segment must last at least a frame and reference boxes inside the Boxes table");
+	static_assert(MovesValid(), "Move segments must be contiguous, cover startup + active + recovery exactly, and only hit on active frames");
+	static_assert(MeleeHasHitboxes(), "Melee moves need a hitbox and projectile moves must not have one");
+	static_assert(WeaponsAreMelee(), "A weapon's attack must be a melee move");
+	static_assert(FightersValid(), "Fighters need positive hp and at least one hurtbox");
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "raylib.h"
+#include "Combat/FrameData.h"
+#include "Render/TextureCache.h"
+#include "Render/RenderSnapshot.h"
+
+using ItemId = uint16_t;
+constexpr ItemId NullItem = UINT16_MAX;
+
+/**
+ * Weapons lying in the world, waiting to be picked up.
+ *
+ * Items live in a fixed pool of Capacity slots (free slots form a list), and each one
+ * is linked into the cell of a uniform grid that holds its centre. Items don't move
+ * or think, so nothing runs for them per tick: the store only does work when an item
+ * spawns, is taken, or a fighter asks what is within its reach, which walks just the
+ * grid cells the reach covers.
+ */
+
+/**
+ * Load every item sprite. Window thread only, before the simulation starts.
+ */
+
+/**
+ * Drop an item in the world.
+ * @param weapon Weapon the item gives.
+ * @param center World-space centre of the item.
+ * @return Handle of the item; NullItem if the pool is full.
+ */
+
+/**
+ * Remove an item (picked up or despawned). Its slot is reused by the next Spawn.
+ * @param id Handle returned by Spawn.
+ */
+
+/**
+ * Find an item overlapping a region, through the grid.
+ * @param reach World-space region, usually a fighter's bounds.
+ * @return The first item found; NullItem if there is none.
+ */
+
+/**
+ * Record a sprite for every item overlapping the view.
+ * @param out Snapshot to append to.
+ * @param view World-space rectangle on screen.
+ */
+class ItemStore
+{
+public:
+	static constexpr size_t Capacity = 256;
+	static constexpr float ItemSize = 40.f; // Width and height of an item
+	static constexpr float CellSize = 240.f; // Grid cell edge; several items' worth
+
+	static void LoadTextures();
+
+	ItemStore();
+	ItemId Spawn(FrameData::WeaponId weapon, Vector2 center);
+	void Remove(ItemId id);
+	ItemId FindInRange(const Rectangle& reach) const;
+	FrameData::WeaponId GetWeapon(ItemId id) const { return m_Items[id].weapon; }
+	size_t Size() const { return m_Count; }
+	void Record(RenderSnapshot& out, const Rectangle& view) const;
+private:
+	struct Item
+	{
+		Rectangle bounds;
+		FrameData::WeaponId weapon;
+		bool alive;
+		ItemId next; // Next item in the same cell, or next free slot
+	};
+
+	static int64_t CellOf(float coordinate) { return static_cast<int64_t>(std::floor(coordinate / CellSize)); }
+	static uint64_t CellKey(int64_t x, int64_t y) { return (static_cast<uint64_t>(x) << 32) ^ static_cast<uint32_t>(y); }
+
+	/**
+	 * Call `fn(id, item)` for every live item overlapping a region, stopping early
+	 * if it returns true.
+	 */
+	template<typename Fn>
+	void Query(const Rectangle& region, Fn&& fn) const
+	{
+		// Items are filed by their centre, so widen the region by half an item
+		constexpr float Half = ItemSize * 0.5f;
+		const int64_t minX = CellOf(region.x - Half), maxX = CellOf(region.x + region.width + Half);
+		const int64_t minY = CellOf(region.y - Half), maxY = CellOf(region.y + region.height + Half);
+		for (int64_t y = minY; y <= maxY; y++)
+		{
+			for (int64_t x = minX; x <= maxX; x++)
+			{
+				auto cell = m_Cells.find(CellKey(x, y));
+				if (cell == m_Cells.end()) continue;
+				for (ItemId id = cell->second; id != NullItem; id = m_Items[id].next)
+				{
+					if (CheckCollisionRecs(m_Items[id].bounds, region) && fn(id, m_Items[id]))
+						return;
+				}
+			}
+		}
+	}
+
+	std::array<Item, Capacity> m_Items;
+	std::unordered_map<uint64_t, ItemId> m_Cells; // Cell key -> first item in the cell
+	ItemId m_FreeHead = 0;
+	size_t m_Count = 0;
+
+	static TextureId s_Textures[FrameData::WeaponCount]; // Indexed by WeaponId; Fists has none
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Combat/FrameData.h"
+#include "NPCs/EntityType.h"
+
+class Entity;
+class Broadphase;
+
+/**
+ * Hitbox/hurtbox resolution for melee attacks.
+ *
+ * Every fighter is attached with its FrameData fighter entry. While it performs a move,
+ * its boxes come from the move's current frame; otherwise it only has its idle
+ * hurtboxes. Each tick Resolve packs every fighter's world-space hurtboxes into flat
+ * arrays, asks the broadphase which fighters are near each active hitbox, and tests
+ * the hitbox against the candidates' hurtboxes four at a time with SSE.
+ *
+ * Each attack remembers the targets it hit, so one swing hits a target at most once
+ * however many active frames overlap it, and stops hitting new targets once it has
+ * hit MaxTargetsPerAttack of them.
+ */
+
+/**
+ * Register a fighter. Fighters must be detached before they are destroyed.
+ * @param fighter Entity to attach.
+ * @param stats FrameData entry with its idle hurtboxes.
+ */
+
+/**
+ * Remove a fighter, cancelling any attack in progress.
+ * @param fighter Entity that is about to be destroyed; ignored if not attached.
+ */
+
+/**
+ * Start a move on a fighter that is not already attacking.
+ * @param fighter Attached fighter.
+ * @param move Melee move to perform.
+ * @param facingLeft Mirror the move's boxes horizontally.
+ * @return true if the attack started; false if the fighter is busy or not attached.
+ */
+
+/**
+ * Apply every hit landed this tick. Run after the broadphase proxies are synced.
+ * @param broadphase Broadphase holding every fighter's proxy.
+ * @return Number of hits.
+ */
+
+/**
+ * Move every attack on by one frame, ending those past their recovery.
+ */
+class MeleeSystem
+{
+public:
+	static constexpr size_t MaxTargetsPerAttack = 8;
+	static constexpr uint32_t HitboxChunk = 4; // Hitboxes sharing one broadphase query
+
+	void Attach(Entity& fighter, FrameData::FighterId stats);
+	void Detach(const Entity& fighter);
+	bool StartAttack(const Entity& fighter, FrameData::MoveId move, bool facingLeft);
+	uint32_t Resolve(Broadphase& broadphase);
+	void Advance();
+private:
+	struct Combatant
+	{
+		Entity* entity;
+		FrameData::FighterId stats;
+		FrameData::MoveId move;
+		uint16_t frame; // Frame of the move being performed
+		bool attacking;
+		bool facingLeft;
+		uint8_t hitCount; // Targets hit by the current attack
+		EntityId hits[MaxTargetsPerAttack];
+		uint32_t hurtFirst; // This tick's hurtboxes in the packed arrays
+		uint32_t hurtCount;
+	};
+
+	void PackHurtboxes();
+	bool Overlaps(const Rectangle& hit, const Combatant& target) const;
+
+	std::vector<Combatant> m_Combatants;
+	std::unordered_map<EntityId, uint32_t> m_Index; // EntityId -> slot in m_Combatants
+
+	// World-space hurtboxes of every fighter this tick, padded to a multiple of four
+	std::vector<float> m_HurtMinX;
+	std::vector<float> m_HurtMinY;
+	std::vector<float> m_HurtMaxX;
+	std::vector<float> m_HurtMaxY;
+	std::vector<void*> m_Candidates; // Reused for broadphase region queries
+};
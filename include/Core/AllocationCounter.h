@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Counts global operator new calls per thread.
+ *
+ * The replacement operator new only bumps a thread-local counter before calling
+ * malloc, so it costs no synchronisation. Diff two readings to get the allocations
+ * a piece of code made.
+ */
+namespace AllocationCounter
+{
+	uint64_t ThisThread();
+}
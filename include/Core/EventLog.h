@@ -0,0 +1,119 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "Core/SpscRing.h"
+
+/**
+ * Severity of a log event; same order as spdlog's levels.
+ */
+enum class LogLevel : uint8_t
+{
+	Trace,
+	Debug,
+	Info,
+	Warn,
+	Error
+};
+
+/**
+ * Hot-path subsystems; each gets its own rate limit.
+ */
+enum class LogCategory : uint8_t
+{
+	Collision,
+	Combat,
+	Count
+};
+
+constexpr size_t LogCategoryCount = static_cast<size_t>(LogCategory::Count);
+
+// Events below this level are compiled out. Override with -DGAME_LOG_LEVEL=<0..4>.
+#ifndef GAME_LOG_LEVEL
+#ifdef NDEBUG
+#define GAME_LOG_LEVEL 2 // Info
+#else
+#define GAME_LOG_LEVEL 0 // Trace
+#endif
+#endif
+
+constexpr LogLevel MinLogLevel = static_cast<LogLevel>(GAME_LOG_LEVEL);
+
+/**
+ * One unformatted log event: a format string literal and up to four numeric arguments.
+ */
+struct LogEvent
+{
+	static constexpr size_t MaxArgs = 4;
+
+	double time; // InputNow() when the event happened
+	const char* format; // fmt-style format string with static storage duration
+	double args[MaxArgs];
+	LogCategory category;
+	LogLevel level;
+};
+
+/**
+ * Non-blocking logger for the simulation's hot path.
+ *
+ * Log stores a LogEvent (no formatting, no I/O) into a lock-free SPSC ring; a
+ * background thread formats the events through spdlog. Levels below MinLogLevel are
+ * removed at compile time, each category is rate-limited by a token bucket before it
+ * reaches the ring, and a full ring drops the event. Suppressed and dropped events are
+ * counted and reported by the background thread, so a bullet storm costs a few stores
+ * per hit and never waits on the console.
+ *
+ * Log may only be called from one thread at a time (the simulation thread); other
+ * threads log through spdlog directly.
+ */
+ 
+/**
+ * Start the formatting thread.
+ */
+ 
+/**
+ * Stop the formatting thread after it has written everything queued.
+ */
+ 
+/**
+ * Queue an event.
+ * @tparam Level Severity; events below MinLogLevel compile to nothing.
+ * @param category Subsystem, for rate limiting and the log prefix.
+ * @param format fmt-style format string literal.
+ * @param args Up to LogEvent::MaxArgs numeric arguments.
+ */
+class EventLog
+{
+public:
+	static void Start();
+	static void Stop();
+
+	template<LogLevel Level, typename... Args>
+	static void Log(LogCategory category, const char* format, Args... args)
+	{
+		static_assert(sizeof...(Args) <= LogEvent::MaxArgs, "Too many log arguments");
+		if constexpr (Level >= MinLogLevel)
+		{
+			LogEvent event{ 0, format, { static_cast<double>(args)... }, category, Level };
+			Push(event);
+		}
+	}
+private:
+	static void Push(LogEvent& event);
+	static void Run();
+	static void Drain();
+
+	static SpscRing<LogEvent, 4096> s_Events;
+	static std::thread s_Thread;
+	static std::atomic<bool> s_Running;
+
+	// Producer-side token buckets, one per category
+	static double s_Tokens[LogCategoryCount];
+	static double s_LastRefill[LogCategoryCount];
+
+	// Counted by the producer, reported by the formatting thread
+	static std::atomic<uint64_t> s_Suppressed[LogCategoryCount];
+	static std::atomic<uint64_t> s_Dropped;
+};
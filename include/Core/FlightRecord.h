@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * On-disk format of flight recorder dumps, shared by the game and the decoder tool.
+ *
+ * A dump is one FlightFileHeader followed by `count` TickRecords, oldest first, in
+ * the writing machine's byte order.
+ */
+
+/**
+ * Why a dump was written.
+ */
+enum class FlightDumpReason : uint32_t
+{
+	Hitch, // A tick went over its time budget
+	Crash // A fatal signal was raised
+};
+
+/**
+ * Everything recorded about one simulation tick.
+ */
+struct TickRecord
+{
+	uint64_t tick;
+	uint32_t dtMicros; // Simulated length of the tick
+	uint32_t updateMicros; // Time spent in Game::update
+	uint32_t collisionMicros; // Time spent in Game::collide
+	uint32_t allocations; // operator new calls on the simulation thread during the tick
+	uint16_t entities; // Entities owned by the Game after the tick
+	uint16_t bullets; // Projectiles in the ProjectileStore after the tick, saturated
+	uint16_t hits; // Collisions the narrowphase confirmed
+	uint8_t inputDown; // Bit per InputAction held at the end of the tick
+	uint8_t fireCount; // Fire presses during the tick
+};
+
+static_assert(sizeof(TickRecord) == 32, "TickRecord is part of the dump format");
+
+struct FlightFileHeader
+{
+	char magic[4]; // "FLTR"
+	uint16_t version;
+	uint16_t recordSize; // sizeof(TickRecord) when written
+	uint32_t count; // Records following the header
+	uint32_t tickMicros; // Nominal tick length
+	FlightDumpReason reason;
+	uint32_t reserved;
+};
+
+static_assert(sizeof(FlightFileHeader) == 24, "FlightFileHeader is part of the dump format");
+
+constexpr char FlightMagic[4] = { 'F', 'L', 'T', 'R' };
+constexpr uint16_t FlightVersion = 1;
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "Core/FlightRecord.h"
+
+/**
+ * Always-on recorder of the last few seconds of simulation ticks.
+ *
+ * The simulation thread appends one TickRecord per tick to a preallocated ring; that
+ * is a 32-byte store, with nothing allocated or locked. Dump copies the ring, oldest
+ * record first, into a second preallocated buffer and hands it to a writer thread, so
+ * a hitch is never made worse by file I/O. A crash handler writes the live ring
+ * straight from the signal handler with async-signal-safe calls only.
+ */
+ 
+/**
+ * Start the writer thread and install the crash handler for this recorder.
+ * @param tickMicros Nominal tick length, stored in every dump header.
+ */
+ 
+/**
+ * Stop the writer thread (after any pending dump) and remove the crash handler.
+ */
+ 
+/**
+ * Append a tick. Simulation thread only.
+ * @param record Tick to store; overwrites the oldest once the ring is full.
+ */
+ 
+/**
+ * Write the ring to `flight-<tick>.bin` in the background.
+ * Ignored while a previous dump is still being written, and until half a ring of
+ * new ticks has been recorded since the last one, so a run of hitches gives one file.
+ * @param reason Stored in the dump header.
+ */
+class FlightRecorder
+{
+public:
+	static constexpr size_t Capacity = 2048; // About 14 seconds at 144 ticks per second
+
+	~FlightRecorder();
+	void Start(uint32_t tickMicros);
+	void Stop();
+
+	void Push(const TickRecord& record)
+	{
+		m_Records[m_Count & (Capacity - 1)] = record;
+		m_Count++;
+	}
+
+	void Dump(FlightDumpReason reason);
+private:
+	static void OnCrash(int signal);
+	void Run();
+	size_t CopyOrdered(TickRecord* out) const;
+
+	TickRecord m_Records[Capacity];
+	uint64_t m_Count = 0; // Records pushed so far; only the simulation thread writes it
+	uint64_t m_LastDump = 0; // m_Count at the last dump
+	uint32_t m_TickMicros = 0;
+
+	// Hand-off to the writer thread
+	TickRecord m_DumpRecords[Capacity];
+	FlightFileHeader m_DumpHeader;
+	uint64_t m_DumpTick = 0;
+	std::atomic<bool> m_DumpPending{ false };
+	bool m_Running = false;
+	std::mutex m_Mutex;
+	std::condition_variable m_Wake;
+	std::thread m_Thread;
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include "Core/Histogram.h"
+
+/**
+ * Wakes a loop up on a fixed cadence with sub-millisecond precision.
+ *
+ * OS sleeps overshoot by up to a scheduler quantum, so the pacer only sleeps until
+ * SpinWindow before the target and busy-waits the rest. An optional idle callback runs
+ * between sleep slices (the window thread samples input there). Each wake-up records
+ * how late it was, in microseconds, into a histogram.
+ *
+ * Deadlines are absolute times on the InputNow() clock, so two pacers started at the
+ * same time with the same interval share their deadlines across threads.
+ */
+ 
+/**
+ * Construct a pacer.
+ * @param interval Seconds between deadlines.
+ */
+ 
+/**
+ * Set the first deadline one interval after `now`.
+ * @param now InputNow() time to start from.
+ */
+ 
+/**
+ * Block until `lead` seconds before the next deadline, then advance to the following one.
+ * If the loop fell a whole interval behind, the schedule restarts from now instead of
+ * running several frames back to back.
+ * @param lead Seconds before the deadline to wake up at (0 for the deadline itself).
+ * @param idle Called with `context` between coarse sleep slices; may be null.
+ * @param context Passed to `idle`.
+ * @return InputNow() time of the wake-up.
+ */
+class FramePacer
+{
+public:
+	explicit FramePacer(double interval);
+	void Start(double now);
+	double Wait(double lead = 0, void (*idle)(void*) = nullptr, void* context = nullptr);
+
+	double GetInterval() const { return m_Interval; }
+	double GetDeadline() const { return m_Deadline; }
+	const Histogram& GetErrorHistogram() const { return m_Error; }
+private:
+	static constexpr double SpinWindow = 0.002; // Busy-wait the last 2 ms
+	static constexpr double IdleSlice = 0.001; // Longest sleep between idle callbacks
+
+	double m_Interval;
+	double m_Deadline = 0;
+	Histogram m_Error; // Wake-up lateness in microseconds
+};
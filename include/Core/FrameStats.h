@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/Histogram.h"
+
+/**
+ * Per-frame quantities FrameStats keeps a distribution of.
+ * Times are in microseconds, counts are plain numbers.
+ */
+enum class FrameMetric : uint8_t
+{
+	Frame, // Time between presented frames (between ticks when headless)
+	Update, // Game::update
+	Collision, // Static resolution, broadphase and narrowphase inside update
+	Draw, // Window thread drawing (snapshot recording when headless)
+	Entities, // Entities owned by the Game after the tick
+	Bullets, // Projectiles in the ProjectileStore after the tick
+	Sprites, // Sprites recorded into the tick's snapshot, after viewport culling
+	PushIterations, // PushboxSolver iterations run inside collision
+	Count
+};
+
+constexpr size_t FrameMetricCount = static_cast<size_t>(FrameMetric::Count);
+
+/**
+ * Distribution of frame timings and load, for spotting spikes rather than averages.
+ *
+ * One histogram per FrameMetric, plus the counts of the slowest update so a spike can
+ * be tied to how much was alive at the time. Recording is lock-free, so the simulation
+ * and window threads record their own metrics while either one reads them.
+ */
+ 
+/**
+ * Record one sample of a metric.
+ * @param metric Metric to record.
+ * @param value Microseconds for times, a count otherwise.
+ */
+ 
+/**
+ * Record an update duration together with the load it ran under.
+ * @param micros Update time in microseconds.
+ * @param entities Entities alive during the update.
+ * @param bullets Bullets alive during the update.
+ */
+ 
+/**
+ * Draw a p50/p95/p99/max table in the window's top-left corner. Window thread only.
+ */
+ 
+/**
+ * Log the same table through spdlog.
+ */
+class FrameStats
+{
+public:
+	void Record(FrameMetric metric, uint64_t value) { m_Metrics[static_cast<size_t>(metric)].Record(value); }
+	void RecordUpdate(uint64_t micros, uint64_t entities, uint64_t bullets);
+	const Histogram& Get(FrameMetric metric) const { return m_Metrics[static_cast<size_t>(metric)]; }
+
+	void DrawOverlay(int x, int y) const;
+	void Report() const;
+private:
+	Histogram m_Metrics[FrameMetricCount];
+
+	// Slowest update so far and the load it ran under; written by the simulation only
+	std::atomic<uint64_t> m_WorstUpdate{ 0 };
+	std::atomic<uint64_t> m_WorstEntities{ 0 };
+	std::atomic<uint64_t> m_WorstBullets{ 0 };
+};
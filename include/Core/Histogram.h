@@ -0,0 +1,36 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed-size log-linear histogram of non-negative integer samples (HDR-style).
+ *
+ * Values below 32 get an exact bucket; above that every power of two is split into
+ * 16 linear sub-buckets, and a bucket reports its midpoint, so any recorded value is
+ * reported within ~3% of its true size. Buckets reach up to 2^41 (larger values
+ * saturate in the top one) in under 2.5 KB, without allocating. Counters are relaxed
+ * atomics: one thread may record while another reads percentiles.
+ */
+class Histogram
+{
+public:
+	void Record(uint64_t value);
+	void Reset();
+
+	uint64_t Count() const { return m_Count.load(std::memory_order_relaxed); }
+	uint64_t Max() const { return m_Max.load(std::memory_order_relaxed); }
+	uint64_t Percentile(double percentile) const;
+private:
+	static constexpr uint32_t SubBits = 4;
+	static constexpr uint32_t SubCount = 1u << SubBits;
+	static constexpr uint32_t MaxShift = 36;
+	static constexpr size_t BucketCount = (MaxShift + 2) * SubCount; // 608 four-byte counters
+
+	static size_t BucketOf(uint64_t value);
+	static uint64_t ValueOf(size_t bucket);
+
+	std::atomic<uint32_t> m_Buckets[BucketCount] = {};
+	std::atomic<uint64_t> m_Count{ 0 };
+	std::atomic<uint64_t> m_Max{ 0 };
+};
@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Core/Histogram.h"
+
+/**
+ * Code regions PerfCounters attributes hardware events to.
+ */
+enum class PerfPhase : uint8_t
+{
+	Update, // Game::update
+	Collision, // Static resolution through the narrowphase, inside Update
+	Draw, // Window thread drawing (snapshot recording when headless)
+	Count
+};
+
+/**
+ * Hardware events counted for every phase.
+ */
+enum class PerfCounter : uint8_t
+{
+	Cycles,
+	Instructions,
+	CacheMisses,
+	BranchMisses,
+	Count
+};
+
+constexpr size_t PerfPhaseCount = static_cast<size_t>(PerfPhase::Count);
+constexpr size_t PerfCounterCount = static_cast<size_t>(PerfCounter::Count);
+
+/**
+ * Hardware performance counters per phase, through Linux perf_event_open.
+ *
+ * Every thread that enters a PerfScope opens its own counter group on first use,
+ * counting user-space events of that thread only. Each scope's deltas go into a
+ * per-frame histogram and a run total per phase and counter. Compiled in only with
+ * GAME_PERF_COUNTERS on Linux; if the kernel refuses the counters (no PMU, or
+ * perf_event_paranoid too strict) a warning is logged once and scopes cost nothing.
+ */
+ 
+/**
+ * Read the calling thread's counters, opening them on first use.
+ * @param values Receives the current counts, indexed by PerfCounter.
+ * @return false if counters are unavailable on this thread.
+ */
+ 
+/**
+ * Add one scope's deltas to a phase.
+ * @param phase Phase the deltas belong to.
+ * @param delta Events counted inside the scope, indexed by PerfCounter.
+ */
+ 
+/**
+ * Log per-frame percentiles and run totals (with IPC and miss rates) for every phase that ran.
+ */
+class PerfCounters
+{
+public:
+	static bool Read(uint64_t (&values)[PerfCounterCount]);
+	void Record(PerfPhase phase, const uint64_t (&delta)[PerfCounterCount]);
+	void Report() const;
+private:
+	Histogram m_PerFrame[PerfPhaseCount][PerfCounterCount];
+	std::atomic<uint64_t> m_Totals[PerfPhaseCount][PerfCounterCount] = {};
+	std::atomic<uint64_t> m_Frames[PerfPhaseCount] = {};
+};
+
+/**
+ * Counts hardware events for its lifetime and records them into a phase.
+ * An empty object unless GAME_PERF_COUNTERS is defined.
+ */
+class PerfScope
+{
+public:
+#ifdef GAME_PERF_COUNTERS
+	PerfScope(PerfCounters& counters, PerfPhase phase)
+		: m_Counters(counters), m_Phase(phase), m_Valid(PerfCounters::Read(m_Start))
+	{}
+
+	~PerfScope()
+	{
+		uint64_t end[PerfCounterCount];
+		if (!m_Valid || !PerfCounters::Read(end)) return;
+		for (size_t i = 0; i < PerfCounterCount; i++)
+			end[i] -= m_Start[i];
+		m_Counters.Record(m_Phase, end);
+	}
+private:
+	PerfCounters& m_Counters;
+	PerfPhase m_Phase;
+	uint64_t m_Start[PerfCounterCount];
+	bool m_Valid;
+#else
+	PerfScope(PerfCounters&, PerfPhase) {}
+#endif
+};
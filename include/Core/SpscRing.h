@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+/**
+ * Bounded, lock-free single-producer/single-consumer ring buffer.
+ *
+ * One thread may push and one other thread may pop, without locks or allocation.
+ * The head and tail counters live on separate cache lines so producer and consumer
+ * don't false-share. Capacity must be a power of two.
+ */
+template<typename T, size_t Capacity>
+class SpscRing
+{
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+public:
+	/**
+	 * Producer side. @return false if the ring is full (the item is dropped).
+	 */
+	bool TryPush(const T& item)
+	{
+		const size_t tail = m_Tail.load(std::memory_order_relaxed);
+		if (tail - m_Head.load(std::memory_order_acquire) == Capacity)
+			return false;
+		m_Items[tail & (Capacity - 1)] = item;
+		m_Tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Consumer side. Points `item` at the oldest element without removing it.
+	 * @return false if the ring is empty.
+	 */
+	bool Peek(const T*& item) const
+	{
+		const size_t head = m_Head.load(std::memory_order_relaxed);
+		if (head == m_Tail.load(std::memory_order_acquire))
+			return false;
+		item = &m_Items[head & (Capacity - 1)];
+		return true;
+	}
+
+	/**
+	 * Consumer side. Removes the oldest element; only valid after a successful Peek.
+	 */
+	void Pop()
+	{
+		m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	/**
+	 * Consumer side. @return false if the ring is empty.
+	 */
+	bool TryPop(T& item)
+	{
+		const T* front;
+		if (!Peek(front))
+			return false;
+		item = *front;
+		Pop();
+		return true;
+	}
+private:
+	alignas(64) std::atomic<size_t> m_Head{ 0 }; // Next slot to read, owned by the consumer
+	alignas(64) std::atomic<size_t> m_Tail{ 0 }; // Next slot to write, owned by the producer
+	alignas(64) T m_Items[Capacity];
+};
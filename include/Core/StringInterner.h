@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+/**
+ * 32-bit handle to an interned string. Equal strings always get the same id, so
+ * comparisons and map lookups on names are plain integer operations.
+ */
+using NameId = uint32_t;
+constexpr NameId InvalidName = UINT32_MAX;
+
+/**
+ * Global, thread-safe string interner.
+ *
+ * Interning takes a lock and hashes the string, so do it once per name (e.g. in a
+ * function-local static) rather than on every spawn. Mapping an id back to its text
+ * is only available in debug builds; release builds don't keep the reverse table.
+ */
+class StringInterner
+{
+public:
+	/**
+	 * Return the id of `name`, adding it on first use.
+	 */
+	static NameId Intern(std::string_view name);
+
+	/**
+	 * Return the id of `name`, or InvalidName if it was never interned.
+	 */
+	static NameId Find(std::string_view name);
+
+#ifndef NDEBUG
+	/**
+	 * Debug-only reverse lookup.
+	 * @return The interned text, or "<invalid>" for an unknown id.
+	 */
+	static const char* Lookup(NameId id);
+#endif
+};
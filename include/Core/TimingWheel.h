@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Handle to a pending timer. Ids are reused once their timer fired or was cancelled.
+ */
+using TimerId = uint32_t;
+constexpr TimerId NullTimer = UINT32_MAX;
+
+/**
+ * Hierarchical timing wheel keyed by simulation tick.
+ *
+ * Four wheels of 256 slots cover 2^32 ticks (over nine months at 144 ticks per second).
+ * A timer goes into the finest wheel whose range reaches its tick; whenever a wheel
+ * wraps, the next slot of the coarser wheel is cascaded down. Scheduling and cancelling
+ * are O(1), and each timer is moved at most once per wheel before it fires, so
+ * advancing costs O(1) amortized per timer and nothing per idle entity.
+ *
+ * Timers live in a pooled array linked into their slot, and callbacks are a plain
+ * function pointer with a context pointer, so scheduling never allocates once warm.
+ */
+ 
+/**
+ * Schedule a callback.
+ * @param tick Tick to fire on; ticks not after the current one fire on the next Advance.
+ * @param callback Function called with `userData` and `tag` when the timer fires.
+ * @param userData Context handed to the callback.
+ * @param tag Extra value handed to the callback, e.g. an index into `userData`.
+ * @return Handle for Cancel, valid until the timer fires.
+ */
+ 
+/**
+ * Cancel a pending timer. Does nothing for NullTimer.
+ * @param id Handle returned by Schedule; must not have fired yet.
+ */
+ 
+/**
+ * Move the wheel forward to `tick`, firing every timer due on the way, in tick order.
+ * Callbacks may schedule and cancel timers.
+ * @param tick New current tick; must not be before the current one.
+ */
+class TimingWheel
+{
+public:
+	using Callback = void (*)(void* userData, uint32_t tag);
+
+	TimingWheel();
+	TimerId Schedule(uint64_t tick, Callback callback, void* userData, uint32_t tag = 0);
+	void Cancel(TimerId id);
+	void Advance(uint64_t tick);
+
+	uint64_t GetTick() const { return m_Tick; }
+	size_t GetPendingCount() const { return m_Pending; }
+private:
+	static constexpr uint32_t SlotBits = 8;
+	static constexpr uint32_t SlotCount = 1u << SlotBits;
+	static constexpr uint32_t LevelCount = 4;
+	static constexpr uint32_t Null = UINT32_MAX;
+
+	struct Timer
+	{
+		uint64_t tick;
+		Callback callback;
+		void* userData;
+		uint32_t tag;
+		uint32_t prev;
+		uint32_t next; // Next timer in the slot, or in the free list
+		uint32_t slot; // Index into m_Slots while pending
+	};
+
+	void Link(uint32_t id);
+	void Unlink(uint32_t id);
+	void Cascade(uint32_t level);
+
+	std::vector<Timer> m_Timers;
+	uint32_t m_Slots[LevelCount * SlotCount];
+	uint32_t m_FreeList = Null;
+	uint64_t m_Tick = 0;
+	size_t m_Pending = 0;
+};
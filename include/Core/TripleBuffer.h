@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Lock-free triple buffer for handing whole values from one writer thread to one reader thread.
+ *
+ * The writer fills its back slot and publishes it; the reader always picks up the most
+ * recently published slot. Neither side ever waits for the other: a slow reader just
+ * skips the values it missed, and a slow writer makes the reader see the same value again.
+ * Slots are reused in place, so values that own heap memory stop allocating once warm.
+ */
+template<typename T>
+class TripleBuffer
+{
+public:
+	/**
+	 * Writer side. The slot to fill for the next Publish; keeps its previous contents.
+	 */
+	T& Back() { return m_Slots[m_Back]; }
+
+	/**
+	 * Writer side. Makes the back slot the latest value and takes a free slot as the new back.
+	 */
+	void Publish()
+	{
+		const uint8_t previous = m_Middle.exchange(m_Back | DirtyBit, std::memory_order_acq_rel);
+		m_Back = previous & IndexMask;
+	}
+
+	/**
+	 * Reader side. Picks up the latest published value, if any, and returns it.
+	 * The reference stays valid until the next Acquire.
+	 */
+	const T& Acquire()
+	{
+		if (m_Middle.load(std::memory_order_relaxed) & DirtyBit)
+			m_Front = m_Middle.exchange(m_Front, std::memory_order_acq_rel) & IndexMask;
+		return m_Slots[m_Front];
+	}
+
+	/**
+	 * Reader side. @return true if a value was published since the last Acquire.
+	 */
+	bool HasNew() const { return (m_Middle.load(std::memory_order_relaxed) & DirtyBit) != 0; }
+private:
+	static constexpr uint8_t IndexMask = 0x3;
+	static constexpr uint8_t DirtyBit = 0x4;
+
+	T m_Slots[3];
+	alignas(64) uint8_t m_Back = 0; // Owned by the writer
+	alignas(64) std::atomic<uint8_t> m_Middle{ 1 }; // Last published slot, plus DirtyBit
+	alignas(64) uint8_t m_Front = 2; // Owned by the reader
+};
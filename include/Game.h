@@ -1,9 +1,28 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <thread>
 #include "raylib.h"
 #include "spdlog/spdlog.h"
 #include "NPCs/Player.h"
+#include "Physics/Broadphase.h"
+#include "Physics/PushboxSolver.h"
+#include "Level/Level.h"
+#include "Level/FlowField.h"
+#include "NPCs/EntityRegistry.h"
+#include "Input/InputSampler.h"
+#include "Core/TripleBuffer.h"
+#include "Core/FramePacer.h"
+#include "Core/FrameStats.h"
+#include "Core/PerfCounters.h"
+#include "Core/FlightRecorder.h"
+#include "NPCs/Projectiles/Emitter.h"
+#include "Combat/MeleeSystem.h"
+#include "Combat/ItemStore.h"
+#include "NPCs/CrowdSteering.h"
+#include "Render/RenderSnapshot.h"
+#include "Render/Viewport.h"
 
 /**
  * Construct a Game with the given window size and title.
@@ -14,7 +33,12 @@
  
 /**
  * Enter and run the main game loop until the window is closed.
- * This continuously processes input, updates game state, and renders frames.
+ * The calling thread renders; the simulation runs on its own thread.
+ */
+ 
+/**
+ * Run the simulation without a window and log a FrameStats report at exit.
+ * @param ticks Number of ticks to simulate.
  */
  
 /**
@@ -23,16 +47,130 @@
  */
  
 /**
- * Render the current game state to the window.
+ * Record the visible part of the current game state into a render snapshot (simulation thread).
+ * @param out Snapshot to append draw commands to.
+ */
+ 
+/**
+ * Render a snapshot published by the simulation (window thread).
+ * @param frame Snapshot to draw; entity state is never read directly.
+ */
+ 
+/**
+ * Load the level and archetypes and spawn the starting entities.
+ */
+ 
+/**
+ * Update the world, record it into a snapshot and collect FrameStats for the tick.
+ * @param dt Tick length in seconds.
+ * @param snapshot Snapshot to overwrite.
+ */
+ 
+/**
+ * Simulation thread body: ticks once per frame deadline and publishes a snapshot per tick.
+ */
+ 
+/**
+ * Log a pacer's wake-up error percentiles.
+ * @param name Loop the pacer drives.
+ * @param pacer Pacer to report.
+ */
+ 
+/**
+ * Take ownership of an entity and register it with the registry and broadphase.
+ * @param entity Entity to add to the world.
+ */
+ 
+/**
+ * Resolve static and dynamic collisions for the tick (static BVH, broadphase, narrowphase).
+ */
+ 
+/**
+ * Consume the input sampled since the last tick and hand it to the players.
+ */
+ 
+/**
+ * Give every player the tick's input and note it in the flight record.
+ * @param input Input for the coming tick.
+ */
+ 
+/**
+ * Register an entity with the type registry and the broadphase.
+ * @param entity Entity that just spawned.
+ */
+ 
+/**
+ * Remove an entity from the type registry and the broadphase.
+ * @param entity Entity that is about to be destroyed.
+ */
+ 
+/**
+ * Resolve an entity against the level's static colliders.
+ * Runs separately from the dynamic broadphase, through the level BVH.
+ * @param entity Entity to test; skipped if its mask excludes CollisionLayer::Static.
+ */
+ 
+/**
+ * Move an entity's broadphase proxy to its current bounds.
+ * @param entity Spawned entity whose bounds should be reflected in the broadphase.
  */
 class Game {
 public:
 	Game(int width, int height, const char* title);
 	void run();
+	void runHeadless(uint64_t ticks);
 	void update(float dt);
-	void draw();
+	void record(RenderSnapshot& out);
+	void draw(const RenderSnapshot& frame);
 private:
+	static constexpr double TickInterval = 1.0 / 144.0; // Seconds between ticks and between frames
+	static constexpr double LatchMargin = 0.0005; // Slack left between a late-latched tick and its deadline
+	static constexpr float LodMargin = 960.f; // Distance outside the view beyond which enemies re-steer less often
+	static constexpr int HordePerSpawn = 32; // Enemies spawned at each of the level's enemy markers
+
+	void load();
+	void step(float dt, RenderSnapshot& snapshot);
+	void simulate();
+	static void logPacing(const char* name, const FramePacer& pacer);
+	void spawn(std::shared_ptr<Entity> entity);
+	void collide();
+	void latchInput();
+	void applyInput(const InputFrame& input);
+	void onSpawn(Entity& entity);
+	void onDespawn(Entity& entity);
+	template<typename T>
+	void collideStatic(T& entity);
+	void syncProxy(Entity& entity);
+
 	std::vector<std::shared_ptr<Entity>> m_Entities;
+	EntityRegistry m_Registry;
+	std::unique_ptr<Broadphase> m_Broadphase;
+	std::vector<BroadphasePair> m_Pairs; // Reused every tick to avoid reallocating
+	PushboxSolver m_Pushboxes; // Keeps fighters from overlapping
+	Level m_Level;
+	FlowField m_Flow; // Towards the first player; every Enemy follows it
+	CrowdSteering m_Crowd; // Steers and moves every Enemy each tick
+	Viewport m_Viewport; // World-space window area; fixed, so both threads read it freely
+	std::vector<void*> m_Visible; // Reused by record() for the broadphase view query
+	InputSampler m_Input;
+	double m_LastTickTime = 0; // InputNow() at the end of the previous tick
+	TripleBuffer<RenderSnapshot> m_Frames; // Simulation -> render hand-off
+	std::thread m_SimThread;
+	std::atomic<bool> m_Running{ false };
+	uint64_t m_Tick = 0; // Ticks simulated so far
+	FramePacer m_RenderPacer{ TickInterval };
+	FramePacer m_SimPacer{ TickInterval };
+	FrameStats m_Stats;
+	PerfCounters m_Perf; // Hardware counters per phase; empty unless GAME_PERF_COUNTERS
+	FlightRecorder m_Recorder; // Last seconds of ticks, dumped on hitches and crashes
+	TickRecord m_Record{}; // Flight record of the tick being simulated
+	EmitterSystem m_Emitters{ TickInterval }; // Attack patterns firing into the ProjectileStore
+	MeleeSystem m_Melee; // Hitbox/hurtbox resolution of every fighter's melee attacks
+	ItemStore m_Items; // Weapons on the floor, picked up by walking over them
+	bool m_ShowStats = false; // FrameStats overlay, toggled with F3
+	bool m_StatsKeyHeld = false;
+	bool m_LateLatch = true; // Start each tick just before its deadline instead of right after the previous one
+	bool m_SimLod = true; // Re-steer enemies far offscreen only every CrowdSteering::LodInterval ticks
 	int m_Width;
 	int m_Height;
 	const char* m_Title;
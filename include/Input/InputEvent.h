@@ -0,0 +1,56 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Game actions the input layer tracks, independent of the physical key.
+ */
+enum class InputAction : uint8_t
+{
+	MoveLeft,
+	MoveRight,
+	MoveUp,
+	MoveDown,
+	Fire,
+	Attack, // Melee attack with the held weapon
+	Count
+};
+
+constexpr size_t InputActionCount = static_cast<size_t>(InputAction::Count);
+
+/**
+ * A single press or release, stamped when the sampler saw it.
+ */
+struct InputEvent
+{
+	double time; // Seconds on the InputNow() clock
+	InputAction action;
+	bool pressed;
+};
+
+/**
+ * Everything the simulation needs to know about input for one tick.
+ */
+struct InputFrame
+{
+	static constexpr size_t MaxPresses = 8;
+
+	float held[InputActionCount] = {}; // Fraction of the tick each action was held, 0..1
+	bool down[InputActionCount] = {}; // State at the end of the tick
+	float fireOffsets[MaxPresses] = {}; // Seconds from each Fire press to the end of the tick
+	uint8_t fireCount = 0;
+	bool attackPressed = false; // Attack went down during the tick
+
+	float Held(InputAction action) const { return held[static_cast<size_t>(action)]; }
+	bool Down(InputAction action) const { return down[static_cast<size_t>(action)]; }
+};
+
+/**
+ * Monotonic clock shared by the input sampler and the simulation, in seconds.
+ */
+inline double InputNow()
+{
+	using namespace std::chrono;
+	return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
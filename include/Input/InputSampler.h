@@ -0,0 +1,42 @@
+#pragma once
+#include "Core/SpscRing.h"
+#include "Input/InputEvent.h"
+
+/**
+ * Samples the keyboard and mouse on the window thread and hands the events to the simulation.
+ *
+ * raylib's input state is only safe to touch from the thread that owns the window, so
+ * Poll pumps OS events and reads the bound keys there, pushing every state change with
+ * its timestamp into a lock-free SPSC ring. The window thread calls it between the
+ * FramePacer's sleep slices (about 1 kHz) and once per frame. The simulation thread
+ * drains the ring once per tick with Consume, which turns the events into an
+ * InputFrame describing exactly when inside the tick things happened.
+ */
+ 
+/**
+ * Pump OS events and push an event for every bound action whose state changed.
+ * Must only be called from the window thread.
+ */
+ 
+/**
+ * Drain all events up to `tickEnd` and summarise them for the tick [tickStart, tickEnd].
+ * Must only be called from one thread (the simulation).
+ * @param tickStart InputNow() time at which the tick began.
+ * @param tickEnd InputNow() time at which the tick ends; later events stay queued.
+ * @return The tick's input frame.
+ */
+class InputSampler
+{
+public:
+	void Poll();
+	InputFrame Consume(double tickStart, double tickEnd);
+private:
+	SpscRing<InputEvent, 1024> m_Events;
+
+	// Producer-side state, only touched by Poll
+	bool m_Sampled[InputActionCount] = {};
+
+	// Consumer-side state, only touched by Consume
+	bool m_Down[InputActionCount] = {};
+	double m_DownSince[InputActionCount] = {};
+};
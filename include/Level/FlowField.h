@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+class Level;
+
+/**
+ * Flow field over a level's tile grid, pointing every open tile towards one target.
+ *
+ * A breadth-first search from the target's tile gives each open tile its step
+ * distance, and each tile then stores a unit direction towards its closest neighbour
+ * (diagonals only when both tiles beside the diagonal are open, so paths never cut
+ * a wall's corner). The field is only rebuilt when the target moves to another tile,
+ * so any number of agents pay one BFS per tile change plus an O(1) Sample each.
+ */
+
+/**
+ * Take the level's tile grid. Call again after loading another level.
+ * @param level Level whose solid tiles block the field.
+ */
+
+/**
+ * Point the field at a new target.
+ * @param target World-space point to flow towards.
+ * @return true if the target changed tile and the field was rebuilt.
+ */
+
+/**
+ * Direction to move from a point.
+ * @param position World-space point.
+ * @return Unit vector along the field; straight at the target on its own tile, off the
+ *         grid or from tiles cut off from it.
+ */
+class FlowField
+{
+public:
+	void Build(const Level& level);
+	bool Update(Vector2 target);
+	Vector2 Sample(Vector2 position) const;
+private:
+	static constexpr uint16_t Unreachable = UINT16_MAX;
+
+	int CellAt(Vector2 position) const; // -1 off the grid
+	void Rebuild();
+
+	std::vector<uint8_t> m_Open; // Row-major, 1 for tiles agents can walk through
+	std::vector<uint16_t> m_Distance; // BFS steps to the target's tile
+	std::vector<float> m_DirX; // Unit direction per tile
+	std::vector<float> m_DirY;
+	std::vector<int> m_Frontier; // BFS queue, reused between rebuilds
+	int m_Columns = 0;
+	int m_Rows = 0;
+	float m_TileSize = 60.f;
+	Vector2 m_Origin = { 0, 0 };
+	Vector2 m_Target = { 0, 0 };
+	int m_TargetCell = -1;
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "raylib.h"
+#include "Physics/StaticBVH.h"
+#include "Combat/FrameData.h"
+
+/**
+ * Static level geometry.
+ *
+ * Levels are plain text files. Header lines set parameters, then a `map` line starts
+ * the tile grid where `#` is solid and anything else is empty. `k` (knife) and `b`
+ * (broken bottle) are empty tiles with a weapon lying in their centre, and `e` marks
+ * where a horde of enemies spawns:
+ *
+ *     tile 60
+ *     origin 0 0
+ *     map
+ *     ..k.####..b.e
+ *
+ * Lines starting with `//` are comments. On load, solid tiles are merged into as
+ * few rectangles as possible and baked into a StaticBVH. Tiles never become Entities.
+ */
+ 
+/**
+ * A weapon placed in the map.
+ */
+struct ItemSpawn
+{
+	FrameData::WeaponId weapon;
+	Vector2 center; // World space
+};
+ 
+/**
+ * Load a level from disk, replacing the current geometry.
+ * @param path Path to the level file.
+ * @return true on success; false if the file can't be read or is malformed.
+ */
+ 
+/**
+ * Draw the level's colliders that overlap a region.
+ * @param view World-space rectangle on screen; colliders outside it are skipped through the BVH.
+ */
+ 
+/**
+ * Test a point against the tile grid in O(1).
+ * @param x World-space x coordinate.
+ * @param y World-space y coordinate.
+ * @return true if the point is inside a solid tile.
+ */
+class Level
+{
+public:
+	bool Load(const char* path);
+	void Draw(const Rectangle& view) const;
+
+	const StaticBVH& GetColliders() const { return m_Colliders; }
+	const std::vector<ItemSpawn>& GetItemSpawns() const { return m_ItemSpawns; }
+	const std::vector<Vector2>& GetEnemySpawns() const { return m_EnemySpawns; } // Tile centres
+	bool IsEmpty() const { return m_Colliders.IsEmpty(); }
+	bool IsSolidAt(float x, float y) const;
+
+	// Tile grid
+	int GetColumns() const { return m_Columns; }
+	int GetRows() const { return m_Rows; }
+	float GetTileSize() const { return m_TileSize; }
+	Vector2 GetOrigin() const { return m_Origin; }
+	bool IsSolidTile(int column, int row) const { return m_Solid[static_cast<size_t>(row) * m_Columns + column] != 0; }
+private:
+	StaticBVH m_Colliders;
+	std::vector<uint8_t> m_Solid; // Row-major tile grid, 1 for solid
+	std::vector<ItemSpawn> m_ItemSpawns;
+	std::vector<Vector2> m_EnemySpawns;
+	int m_Columns = 0;
+	int m_Rows = 0;
+	float m_TileSize = 60.f;
+	Vector2 m_Origin = { 0, 0 };
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "NPCs/EntityRegistry.h"
+
+class Enemy;
+class Broadphase;
+class FlowField;
+class Viewport;
+
+/**
+ * Batched steering for the enemy crowd: seek along the flow field, separation from
+ * close neighbours and alignment with their heading.
+ *
+ * Each tick, one pass gathers every enemy's position, velocity and flow direction into
+ * structure-of-arrays buffers and sums its neighbour terms. Neighbours come from the
+ * collision broadphase through a bounded QueryNearby, so an enemy never looks at more
+ * than MaxNeighbors others however dense the crowd gets. A second pass blends the
+ * three terms, clamps the result to the enemy walk speed, eases every velocity
+ * towards it and integrates the position, four enemies at a time with SSE. A last
+ * pass stores both back into the hot records. Enemies are flagged Steered, so
+ * EntityStore::Integrate leaves them alone. The pushbox solver still settles whatever
+ * overlap steering leaves.
+ *
+ * Enemies far outside the view only re-steer every LodInterval ticks, each on its own
+ * slot, and coast on their last velocity in between.
+ */
+
+/**
+ * Steer and move every enemy for this tick. Runs in place of EntityStore::Integrate for them.
+ * @param agents Every enemy, from the registry.
+ * @param broadphase Collision broadphase, synced at the end of the previous tick.
+ * @param flow Field towards the chase target.
+ * @param lod Viewport deciding which enemies are far, or nullptr to steer all every tick.
+ * @param tick Current tick, to spread far enemies' slots.
+ * @param dt Tick length in seconds.
+ */
+class CrowdSteering
+{
+public:
+	static constexpr size_t MaxNeighbors = 6;
+	static constexpr float NeighborRadius = 90.f; // From centre to centre
+	static constexpr float SeekWeight = 1.f;
+	static constexpr float SeparationWeight = 1.5f;
+	static constexpr float AlignmentWeight = 0.3f;
+	static constexpr float Responsiveness = 10.f; // Fraction of the gap to the wanted velocity closed per second
+	static constexpr uint32_t LodInterval = 4; // Ticks between steering updates of a far enemy
+
+	void Update(TypedView<Enemy> agents, Broadphase& broadphase, const FlowField& flow,
+		const Viewport* lod, uint64_t tick, float dt);
+private:
+	// Per agent, padded to a multiple of four; separation and alignment in walk speeds
+	std::vector<float> m_PX; // Top-left corner
+	std::vector<float> m_PY;
+	std::vector<float> m_VX;
+	std::vector<float> m_VY;
+	std::vector<float> m_SeekX;
+	std::vector<float> m_SeekY;
+	std::vector<float> m_SeparationX;
+	std::vector<float> m_SeparationY;
+	std::vector<float> m_AlignX;
+	std::vector<float> m_AlignY;
+	std::vector<float> m_Blend; // Fraction of the gap to the wanted velocity closed this tick
+	std::vector<void*> m_Neighbors; // Reused for every QueryNearby
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "NPCs/Entity.h"
+#include "Combat/FrameData.h"
+
+/**
+ * Opponent entity.
+ *
+ * Uses the player's idle sprite. Enemies have no per-entity behaviour: the whole
+ * crowd is steered towards the player and moved in one batch by CrowdSteering,
+ * which re-steers those far outside the view only every few ticks.
+ */
+
+/**
+ * Construct an Enemy with the default sprite and hit points.
+ */
+
+/**
+ * Interned name and animation clips shared by every Enemy.
+ */
+
+class Enemy final : public EntityBase<Enemy>
+{
+public:
+	static constexpr EntityType Type = EntityType::Enemy;
+	static constexpr FrameData::FighterId Fighter = FrameData::FighterId::Enemy;
+
+	Enemy();
+	static const Archetype& GetArchetype();
+};
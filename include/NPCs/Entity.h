@@ -1,104 +1,181 @@
 #pragma once
+#include <cassert>
 #include <string>
 #include <vector>
 #include <memory>
 
 #include "raylib.h"
 #include "spdlog/spdlog.h"
+#include "Physics/CollisionLayer.h"
+#include "Physics/Broadphase.h"
+#include "NPCs/EntityType.h"
+#include "NPCs/EntityHot.h"
+#include "Render/TextureCache.h"
+#include "Render/Animation.h"
+#include "Render/RenderSnapshot.h"
+#include "Core/StringInterner.h"
+#include "Core/EventLog.h"
+
+static_assert(CollisionLayer::LayerCount <= 8 * sizeof(EntityHot::mask) && CollisionLayer::LayerCount <= 8 * sizeof(EntityHot::layer),
+	"Every CollisionLayer bit must fit in EntityHot's layer and mask fields");
+
+/**
+ * Per-class spawn data, resolved once per concrete type: the interned name and the
+ * animation clips. Spawning an entity copies an integer and a pointer instead of
+ * hashing strings or loading textures.
+ */
+struct Archetype
+{
+	NameId name;
+	AnimationSet animations;
+};
 
 /**
-	 * Construct an Entity with a texture, name, and starting hit points.
-	 * @param texturePath Path to the entity's texture asset.
-	 * @param name Human-readable name for the entity.
+	 * Construct an Entity with its animations, name, and starting hit points.
+	 * Only concrete entity classes construct entities, through EntityBase.
+	 * @param archetype Interned name and animation clips of the concrete class.
 	 * @param hp Initial hit points (health) of the entity.
-	 */
-	
-	/**
-	 * Perform the entity's per-frame update.
-	 * @param dt Time delta in seconds since the last update.
-	 */
-	
-	/**
-	 * Render the entity.
+	 * @param collisionLayer CollisionLayer bit the entity lives on; its mask starts as the layer's default row.
+	 * @param type Type tag of the concrete class (its `Type` constant).
 	 */
 	
 	/**
 	 * Test whether this entity collides with another entity.
-	 * Override to provide custom collision logic.
-	 * @param other Shared pointer to the other entity to test against.
+	 * Pairs whose layer is not in this entity's collision mask are rejected before any geometry is read.
+	 * Concrete classes hide this to provide custom collision logic; callers dispatch
+	 * through VisitEntity so the right one is bound at compile time.
+	 * @param other The other entity to test against.
 	 * @return true if this entity collides with `other`, otherwise false.
 	 */
 	
 	/**
-	 * Test whether this entity collides with any entity in the provided collection.
-	 * Returns true as soon as a collision with any element is found.
-	 * @param others Collection of shared pointers to entities to test against.
-	 * @return true if a collision is found with any entity in `others`, otherwise false.
+	 * React to overlapping a piece of static level geometry.
+	 * The default pushes the entity out along the axis of least penetration.
+	 * Concrete classes may hide it with their own reaction.
+	 * @param wall World-space rectangle of the static collider.
 	 */
-	class Entity 
+
+class Entity
 {
 public:
-	Entity(
-		const char* texturePath,
-		const std::string name,
-		float hp
-	);
-	void Update(float dt)
-	{
-		CommonUpdate(dt);
-		OnUpdate(dt); // For subclasses
-	}
-	void Draw()
-	{
-		CommonDraw();
-		OnDraw(); // For subclasses
-	}
+	~Entity();
+	Entity(const Entity&) = delete;
+	Entity& operator=(const Entity&) = delete;
+
+	bool CheckCollision(Entity& other);
+	void OnStaticCollision(const Rectangle& wall);
 
-	virtual bool CheckCollision(std::shared_ptr<Entity> other);
-	virtual bool CheckCollision(std::vector<std::shared_ptr<Entity>> others)
+	// Hot simulation record
+	EntityHot& Hot() { return EntityStore::Get(m_HotIndex); }
+	const EntityHot& Hot() const { return EntityStore::Get(m_HotIndex); }
+
+	// Collision filtering
+	uint32_t GetCollisionLayer() const { return Hot().layer; }
+	uint32_t GetCollisionMask() const { return Hot().mask; }
+	void SetCollisionMask(uint32_t mask)
 	{
-		for (auto entity : others)
-		{
-			if (CheckCollision(entity)) return true;
-		}
-		return false;
+		assert(mask == static_cast<decltype(EntityHot::mask)>(mask) && "Collision mask wider than EntityHot::mask");
+		Hot().mask = static_cast<decltype(EntityHot::mask)>(mask);
 	}
+	bool CollidesWithLayer(uint32_t layer) const { return (Hot().mask & layer) != 0; }
+
+	// Type queries
+	EntityType GetType() const { return m_Type; }
+	EntityId GetId() const { return m_Id; }
+	uint32_t GetRegistryIndex() const { return m_RegistryIndex; }
+	void SetRegistryIndex(uint32_t index) { m_RegistryIndex = index; }
+
+	// Broadphase bookkeeping
+	Rectangle GetBounds() const { return Hot().Bounds(); }
+	ProxyId GetProxyId() const { return m_ProxyId; }
+	void SetProxyId(ProxyId id) { m_ProxyId = id; }
 
 	// Info functions
-	virtual const std::string GetName() const { return m_Name; }
-	virtual float GetHp() const { return m_Hp; }
-	virtual const Texture2D& GetTexture() const { return m_Texture; }
-	virtual void TakeDamage(float damage); /**
+	NameId GetNameId() const { return m_NameId; }
+#ifndef NDEBUG
+	const char* GetName() const { return StringInterner::Lookup(m_NameId); } // Debug builds only
+#endif
+	float GetHp() const { return Hot().hp; }
+	// Animation: locomotion states loop, one-shots (attacks) play once over them
+	void SetAnimState(AnimState state) { AnimationStore::Get(m_AnimIndex).SetState(state); }
+	void PlayAnimation(AnimState state) { AnimationStore::Get(m_AnimIndex).Play(state); }
+	void TakeDamage(float damage);
+	void Despawn() { Hot().flags &= ~EntityFlags::Alive; } // Removed by the owner at the end of the tick
+	/**
  * Returns whether the entity is alive.
  *
  * @return true if the entity is alive; false otherwise.
  */
-	virtual bool IsAlive() { return m_IsAlive; }
+	bool IsAlive() const { return (Hot().flags & EntityFlags::Alive) != 0; }
 
 	/**
  * Get a mutable reference to the entity's position.
  *
- * Returns a non-const reference to the internal Vector2 representing this
- * entity's position so callers can read or modify the position directly.
+ * Returns a non-const reference to the position in the entity's hot record so callers
+ * can read or modify it directly. Don't hold on to it across entity spawns or despawns.
  *
  * @return Reference to the entity's position (Vector2&).
  */
-virtual Vector2& GetPosition() { return m_Position; }
+Vector2& GetPosition() { return Hot().position; }
 
 protected:
-	bool m_IsAlive = true;
-	float m_Hp;
-	float m_Velocity = 100.f; // default
+	Entity(
+		const Archetype& archetype,
+		float hp,
+		uint32_t collisionLayer,
+		EntityType type
+	);
 
-	std::string m_Name;
+	// Cold data: only read by rendering, debugging and bookkeeping
+	NameId m_NameId;
+	EntityType m_Type;
+	EntityId m_Id; // Unique for the process lifetime
+	ProxyId m_ProxyId = NullProxy; // Handle in the Game's broadphase
+	uint32_t m_RegistryIndex = UnregisteredIndex; // Slot in the EntityRegistry list of m_Type
 
-	Texture2D m_Texture;
-	Vector2 m_Position = { 0, 0 };
+	void OnUpdate(float) {} // Custom update hook, hidden by subclasses (No default functionality)
+	void OnDraw(RenderSnapshot&) {} // Custom draw hook, hidden by subclasses (No default functionality)
+	void CommonDraw(RenderSnapshot& out) const; // Standard draw function for all entities
+private:
+	friend class EntityStore;
+	friend class AnimationStore;
+	uint32_t m_HotIndex; // Slot in the EntityStore
+	uint32_t m_AnimIndex; // Slot in the AnimationStore
+};
 
+/**
+ * CRTP base every concrete entity derives from.
+ *
+ * Update and Draw call the derived class's OnUpdate/OnDraw directly, so there is no
+ * vtable anywhere in the entity hierarchy and per-type loops inline the whole body.
+ * The derived class may keep its hooks private and befriend EntityBase<Derived>, and
+ * must provide `static const Archetype& GetArchetype()`.
+ */
+template<typename Derived>
+class EntityBase : public Entity
+{
+public:
+	/**
+	 * Perform the entity's per-frame update. Movement is integrated afterwards for all
+	 * entities at once by EntityStore::Integrate.
+	 * @param dt Time delta in seconds since the last update.
+	 */
+	void Update(float dt)
+	{
+		static_cast<Derived*>(this)->OnUpdate(dt); // For subclasses
+	}
 
-	virtual void OnUpdate(float) {} // Custom update function for flexibility for subclasses (No default functionality)
-	virtual void OnDraw() {} // Custom draw function for flexibility for subclasses (No default functionality)
-private:
-	void CommonUpdate(float dt); // Standard update function for all entities 
-	void CommonDraw(); // Standard draw function for all entities
+	/**
+	 * Record the entity's draw commands into a render snapshot.
+	 * @param out Snapshot of the current tick; drawn later by the render thread.
+	 */
+	void Draw(RenderSnapshot& out)
+	{
+		CommonDraw(out);
+		static_cast<Derived*>(this)->OnDraw(out); // For subclasses
+	}
+protected:
+	EntityBase(float hp, uint32_t collisionLayer)
+		: Entity(Derived::GetArchetype(), hp, collisionLayer, Derived::Type)
+	{}
 };
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+class Entity;
+
+namespace EntityFlags
+{
+	enum : uint8_t
+	{
+		Alive = 1u << 0,
+		Steered = 1u << 1, // Moved by CrowdSteering, so EntityStore::Integrate skips it
+	};
+}
+
+/**
+ * The fields the simulation touches every tick, packed into half a cache line.
+ *
+ * Everything else about an entity (name, texture, bookkeeping handles) stays in the
+ * Entity object itself, which acts as the cold side table.
+ */
+struct EntityHot
+{
+	Vector2 position; // Top-left corner
+	Vector2 velocity; // Units per second, integrated by EntityStore::Integrate (or CrowdSteering)
+	Vector2 halfExtents;
+	float hp;
+	uint8_t flags; // EntityFlags
+	uint8_t layer; // CollisionLayer bit
+	uint8_t mask; // CollisionLayer mask
+	uint8_t reserved;
+
+	Rectangle Bounds() const
+	{
+		return { position.x, position.y, halfExtents.x * 2.f, halfExtents.y * 2.f };
+	}
+};
+
+static_assert(sizeof(EntityHot) == 32, "EntityHot must stay two records per cache line");
+
+/**
+ * Dense, process-wide array of EntityHot records.
+ *
+ * Every Entity owns one slot for its lifetime. Releasing a slot moves the last record
+ * into it, so the array never has holes and batch passes stream through it linearly.
+ */
+class EntityStore
+{
+public:
+	static uint32_t Allocate(Entity* owner);
+	static void Release(uint32_t index);
+
+	static EntityHot& Get(uint32_t index) { return s_Hot[index]; }
+	static size_t Size() { return s_Hot.size(); }
+
+	static void Integrate(float dt);
+private:
+	static std::vector<EntityHot> s_Hot;
+	static std::vector<Entity*> s_Owners; // Parallel to s_Hot, to patch indices on release
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include <array>
+#include <vector>
+
+#include "NPCs/Entity.h"
+#include "NPCs/EntityType.h"
+
+/**
+ * Read-only view over a registry list, yielding `T*` without any cast check.
+ * Safe because a list only ever holds entities whose tag is `T::Type`.
+ */
+template<typename T>
+class TypedView
+{
+public:
+	class Iterator
+	{
+	public:
+		explicit Iterator(Entity* const* it) : m_It(it) {}
+		T* operator*() const { return static_cast<T*>(*m_It); }
+		Iterator& operator++() { ++m_It; return *this; }
+		bool operator!=(const Iterator& other) const { return m_It != other.m_It; }
+	private:
+		Entity* const* m_It;
+	};
+
+	TypedView(Entity* const* begin, Entity* const* end) : m_Begin(begin), m_End(end) {}
+	Iterator begin() const { return Iterator(m_Begin); }
+	Iterator end() const { return Iterator(m_End); }
+	size_t size() const { return static_cast<size_t>(m_End - m_Begin); }
+	bool empty() const { return m_Begin == m_End; }
+private:
+	Entity* const* m_Begin;
+	Entity* const* m_End;
+};
+
+/**
+ * Per-type lists of live entities.
+ *
+ * Entities are added on spawn and removed on despawn; removal swaps the last entry
+ * into the freed slot, so both are O(1) and the lists stay dense. Queries return the
+ * cached list for a type directly, e.g. `View<Player>()` for all players or
+ * `View<Enemy>()` for all enemies.
+ */
+class EntityRegistry
+{
+public:
+	void Add(Entity& entity);
+	void Remove(Entity& entity);
+
+	template<typename T>
+	TypedView<T> View() const
+	{
+		const std::vector<Entity*>& list = m_Lists[static_cast<size_t>(T::Type)];
+		return TypedView<T>(list.data(), list.data() + list.size());
+	}
+
+	size_t Count(EntityType type) const { return m_Lists[static_cast<size_t>(type)].size(); }
+private:
+	std::array<std::vector<Entity*>, EntityTypeCount> m_Lists;
+};
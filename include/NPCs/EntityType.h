@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Compile-time type tag of every concrete entity.
+ *
+ * Each entity class exposes its tag as `static constexpr EntityType Type`, and every
+ * instance stores it, so type queries are an integer compare instead of an RTTI walk.
+ */
+enum class EntityType : uint8_t
+{
+	Enemy,
+	Player,
+	Count
+};
+
+constexpr size_t EntityTypeCount = static_cast<size_t>(EntityType::Count);
+
+// Slot value of an entity that is not in an EntityRegistry
+constexpr uint32_t UnregisteredIndex = UINT32_MAX;
+
+/**
+ * Stable, never reused id of an entity, for records that outlive it (e.g. a projectile's shooter).
+ */
+using EntityId = uint32_t;
+constexpr EntityId NullEntity = 0;
@@ -0,0 +1,62 @@
+#pragma once
+#include <utility>
+
+#include "NPCs/EntityType.h"
+#include "NPCs/Enemy.h"
+#include "NPCs/Player.h"
+
+/**
+ * The closed set of concrete entity types.
+ *
+ * Systems iterate it with ForEachEntityType to run one loop per concrete type, and
+ * dispatch a single Entity& with VisitEntity. Both bind to the concrete class at
+ * compile time, so every hook call is direct and can be inlined.
+ */
+template<typename... Ts>
+struct TypeList {};
+
+template<typename T>
+struct TypeTag { using type = T; };
+
+// Order matches EntityType, which is also the update and draw order
+using EntityTypeList = TypeList<Enemy, Player>;
+
+template<typename... Ts>
+constexpr bool MatchesEntityTypeOrder(TypeList<Ts...>)
+{
+	size_t index = 0;
+	bool ok = sizeof...(Ts) == EntityTypeCount;
+	((ok = ok && static_cast<size_t>(Ts::Type) == index++), ...);
+	return ok;
+}
+static_assert(MatchesEntityTypeOrder(EntityTypeList{}), "EntityTypeList must list every EntityType in enum order");
+
+/**
+ * Call `fn(TypeTag<T>{})` once for every concrete entity type, in EntityType order.
+ */
+template<typename Fn, typename... Ts>
+void ForEachType(TypeList<Ts...>, Fn&& fn)
+{
+	(fn(TypeTag<Ts>{}), ...);
+}
+
+template<typename Fn>
+void ForEachEntityType(Fn&& fn)
+{
+	ForEachType(EntityTypeList{}, std::forward<Fn>(fn));
+}
+
+/**
+ * Call `fn(T&)` with the entity downcast to its concrete type.
+ * The switch over the stored tag replaces a virtual call or dynamic_cast.
+ */
+template<typename Fn>
+decltype(auto) VisitEntity(Entity& entity, Fn&& fn)
+{
+	switch (entity.GetType())
+	{
+	case EntityType::Player: return fn(static_cast<Player&>(entity));
+	case EntityType::Enemy:
+	default:                 return fn(static_cast<Enemy&>(entity));
+	}
+}
@@ -1,23 +1,20 @@
 #pragma once
 
-#include <vector>
-
 #include "NPCs/Entity.h"
+#include "Input/InputEvent.h"
+#include "Combat/FrameData.h"
 
 #define IDLE "resources/Player/idle.png"
 #define LEFT "resources/Player/left.png"
 #define RIGHT "resources/Player/right.png"
 #define UP "resources/Player/up.png"
+#define SHOT "resources/Projectiles/bullet.png"
 
 /**
  * Player entity representing the user-controlled character.
  *
- * Manages player state, animations, and projectiles spawned by the player.
- */
- 
-/**
- * Pointers to active bullet entities spawned by the player.
- * The container holds Entity* for each bullet; ownership semantics are determined by the rest of the codebase.
+ * Manages player state and animations, fires shots into the ProjectileStore and
+ * requests melee attacks with the weapon it holds (performed by the MeleeSystem).
  */
  
 /**
@@ -26,21 +23,57 @@
  * Initializes player-specific state and resources.
  */
  
+/**
+ * Interned name and animation clips shared by every Player.
+ */
+ 
+/**
+ * Sprite of the player's shots, loaded together with the archetype so the simulation
+ * thread never has to touch the GPU.
+ */
+ 
+/**
+ * Hand the player the input sampled for the coming tick.
+ * @param input Timestamped input summary built by the InputSampler.
+ */
+ 
+/**
+ * Whether Attack was pressed this tick; Game starts the held weapon's move from it.
+ */
+ 
+/**
+ * Weapon in hand; its FrameData entry picks the move Attack performs.
+ */
+ 
 /**
  * Update the player once per frame.
  *
  * @param dt Elapsed time since the last update in seconds.
  */
  
-/**
- * Render the player using its current visual state (animation/frame).
- */
-class Player : public Entity
+class Player final : public EntityBase<Player>
 {
 public:
-	std::vector<Entity*> m_Bullets;
+	static constexpr EntityType Type = EntityType::Player;
+	static constexpr FrameData::FighterId Fighter = FrameData::FighterId::Player;
+
 	Player();
+	static const Archetype& GetArchetype();
+	void SetInput(const InputFrame& input);
+	bool WantsAttack() const { return m_AttackRequested; }
+	bool IsFacingLeft() const;
+	FrameData::WeaponId GetWeapon() const { return m_Weapon; }
+	void SetWeapon(FrameData::WeaponId weapon) { m_Weapon = weapon; }
 private:
-	void OnUpdate(float dt) override;
-	void OnDraw() override;
+	friend class EntityBase<Player>;
+	static constexpr const FrameData::Fighter& Stats = FrameData::GetFighter(Fighter);
+	static constexpr uint16_t AttackTicks = 18; // Length of the attack pose
+
+	static TextureId GetShotTexture();
+	float m_Speed = Stats.walkSpeed; // Movement speed in units per second
+	InputFrame m_Input; // Input for the tick being simulated
+	FrameData::WeaponId m_Weapon = FrameData::WeaponId::Fists;
+	bool m_AttackRequested = false;
+	bool m_FacingLeft = false; // Shooting and melee direction, from the A/D input
+	void OnUpdate(float dt);
 };
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "raylib.h"
+#include "Core/StringInterner.h"
+#include "Render/TextureCache.h"
+
+class Entity;
+
+enum class EmitterShape : uint8_t
+{
+	Radial, // `count` shots spread evenly over `spread` degrees around a fixed heading
+	Spiral, // Like Radial, but the heading turns by `spin` degrees after every volley
+	Aimed, // `count` shots fanned over `spread` degrees around the direction to the target
+};
+
+/**
+ * One attack pattern, as read from a pattern file.
+ */
+struct EmitterPattern
+{
+	NameId name;
+	EmitterShape shape;
+	uint32_t count; // Shots per volley
+	float speed; // Units per second
+	float spread; // Degrees covered by one volley; 360 for a full ring
+	float spin; // Degrees the heading turns per volley (Spiral)
+	uint32_t interval; // Ticks between volleys
+	float lifetime; // Seconds before an unspent shot despawns
+	float damage;
+	TextureId texture;
+	Vector2 size; // Full size of one shot
+};
+
+/**
+ * Attack patterns, loaded once from a text file.
+ *
+ * A `texture` line selects the sprite of the patterns that follow, then each
+ * `pattern` line describes one pattern:
+ *
+ *     texture resources/Projectiles/bullet.png
+ *     // name shape count speed spread spin interval lifetime damage
+ *     pattern ring radial 24 220 360 0 72 4 10
+ *
+ * Shapes are `radial`, `spiral` and `aimed`. Lines starting with `//` are comments.
+ * Shots are drawn at half the texture's size, like player shots.
+ */
+
+/**
+ * Load a pattern file, replacing the loaded patterns. Loads textures, so window thread only.
+ * @param path Path to the pattern file.
+ * @return true on success; false (and the old patterns kept) if the file can't be read or is malformed.
+ */
+
+/**
+ * Look up a loaded pattern.
+ * @param name Name of the pattern.
+ * @return The pattern, or nullptr if there is none with that name.
+ */
+class EmitterPatterns
+{
+public:
+	static bool Load(const char* path);
+	static const EmitterPattern* Find(std::string_view name);
+private:
+	static std::vector<EmitterPattern> s_Patterns;
+};
+
+/**
+ * Fires attack patterns from entities into the ProjectileStore.
+ *
+ * Each volley is appended as one batch, and its directions come from rotating a unit
+ * vector by the fixed angle between shots, so a volley of hundreds costs two
+ * trigonometric calls.
+ */
+
+/**
+ * Start firing a pattern from an entity. An entity may carry several emitters.
+ * @param owner Entity the shots come from, recorded as their shooter.
+ * @param pattern Pattern to fire; must outlive the emitter.
+ * @param tick Tick of the first volley.
+ */
+
+/**
+ * Stop every emitter attached to an entity.
+ * @param owner Entity that is about to be destroyed.
+ */
+
+/**
+ * Fire every volley due on a tick.
+ * @param tick Tick being simulated.
+ * @param target Entity that aimed patterns fire at, or nullptr to fire straight down.
+ * @return Number of shots fired.
+ */
+class EmitterSystem
+{
+public:
+	explicit EmitterSystem(double tickInterval) : m_TickInterval(tickInterval) {}
+
+	void Attach(Entity& owner, const EmitterPattern& pattern, uint64_t tick);
+	void Detach(const Entity& owner);
+	size_t Update(uint64_t tick, Entity* target);
+private:
+	struct Emitter
+	{
+		Entity* owner;
+		const EmitterPattern* pattern;
+		uint64_t nextTick;
+		float heading; // Degrees, 0 is +x, 90 is down
+	};
+
+	double m_TickInterval;
+	std::vector<Emitter> m_Emitters;
+};
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+#include "Core/TimingWheel.h"
+#include "NPCs/EntityType.h"
+#include "Render/TextureCache.h"
+#include "Render/RenderSnapshot.h"
+
+class Entity;
+class Level;
+
+using ProjectileHandle = uint32_t;
+constexpr ProjectileHandle NullProjectile = UINT32_MAX;
+
+/**
+ * Writable view of projectiles just appended to the ProjectileStore.
+ *
+ * Each pointer addresses `count` consecutive slots; the spawner fills in the
+ * positions (top-left) and velocities.
+ */
+struct ProjectileBatch
+{
+	float* x;
+	float* y;
+	float* vx;
+	float* vy;
+	size_t count;
+};
+
+/**
+ * World-level, pooled structure-of-arrays store of every projectile, whoever fired it
+ * (player shots and emitter bullets alike).
+ *
+ * Projectiles are plain rows of parallel arrays, not Entities: no registry slot, no
+ * broadphase proxy, no heap object. The shooter is kept as an EntityId, so a row never
+ * points at an entity that may already be gone. Integration, level collision and
+ * recording are each one pass over the whole store. For entity collision, Bin sorts the
+ * live projectiles once per tick into a hashed uniform grid, copying their bounds into
+ * cell-ordered arrays; each entity then only tests the cells under its bounds, with
+ * the AABB tests running four projectiles at a time with SSE over those arrays.
+ *
+ * Rows stay dense: Kill only flags a projectile, and Compact squeezes out the flagged
+ * rows at the end of the tick. Handles go through a sparse table so lifetime timers
+ * (on the store's own TimingWheel, tagged with the handle) survive the moves.
+ */
+
+/**
+ * Append `count` projectiles sharing one shooter, texture, size, damage and lifetime.
+ * @param count Number of projectiles to add.
+ * @param shooter Entity that fired them; its layer picks the projectile layer and it is never hit by them.
+ * @param texture Sprite drawn stretched over each projectile.
+ * @param size Full width and height of each projectile.
+ * @param damage Damage dealt to the first entity hit.
+ * @param lifetime Ticks after the current one on which the projectiles despawn if they haven't hit anything.
+ * @return The new rows, to be filled with positions and velocities.
+ */
+
+/**
+ * Record a sprite for every live projectile overlapping the view.
+ * @param out Snapshot to append to.
+ * @param view World-space rectangle on screen.
+ */
+
+/**
+ * Sort the live projectiles into the collision grid. Call after Integrate and
+ * CollideLevel; Append, Compact and Integrate leave the grid stale.
+ */
+
+/**
+ * Collide the live projectiles binned near one entity's bounds.
+ * @param target Entity to test; only projectiles on a layer in its mask, fired by someone else, can hit it.
+ * @return Number of hits.
+ */
+class ProjectileStore
+{
+public:
+	static ProjectileBatch Append(size_t count, const Entity& shooter, TextureId texture, Vector2 size, float damage, uint32_t lifetime);
+	static void Kill(size_t index) { s_Dead[index] = 1; }
+	static size_t Size() { return s_X.size(); }
+
+	static void Advance(uint64_t tick);
+	static void Integrate(float dt);
+	static uint32_t CollideTarget(Entity& target);
+	static void CollideLevel(const Level& level);
+	static void Bin();
+	static void Compact();
+	static void Record(RenderSnapshot& out, const Rectangle& view);
+private:
+	static void Expire(void* userData, uint32_t handle);
+
+	// Dense rows, all the same length
+	static std::vector<float> s_X; // Top-left corner
+	static std::vector<float> s_Y;
+	static std::vector<float> s_VX; // Units per second
+	static std::vector<float> s_VY;
+	static std::vector<float> s_Width;
+	static std::vector<float> s_Height;
+	static std::vector<float> s_Damage;
+	static std::vector<uint8_t> s_Layer; // CollisionLayer bit
+	static std::vector<EntityId> s_Shooter;
+	static std::vector<uint8_t> s_Dead; // Killed this tick, removed by Compact
+	static std::vector<TextureId> s_Texture;
+	static std::vector<ProjectileHandle> s_Handle;
+	static std::vector<TimerId> s_Timer; // Lifetime timer, NullTimer once fired
+
+	// Collision grid, rebuilt by Bin: cells hash into BinCount buckets, each a range of the arrays below
+	static constexpr float CellSize = 128.f;
+	static constexpr uint32_t BinCount = 4096; // Power of two
+	static uint32_t BinOf(int column, int row);
+	static std::vector<uint32_t> s_BinStart; // BinCount + 1 offsets into the binned arrays
+	static std::vector<uint32_t> s_BinCursor; // Scatter cursors, reused by Bin
+	static std::vector<uint32_t> s_RowBin; // Per row, its bucket or NullBin when dead
+	static std::vector<uint32_t> s_BinRow; // Binned order -> row
+	static std::vector<float> s_BinLeft; // Bounds in binned order
+	static std::vector<float> s_BinTop;
+	static std::vector<float> s_BinRight;
+	static std::vector<float> s_BinBottom;
+	static float s_BinReach; // Largest half extent binned; projectiles are binned by their centre
+
+	static std::vector<uint32_t> s_Rows; // Handle -> row
+	static std::vector<ProjectileHandle> s_FreeHandles;
+	static TimingWheel s_Lifetimes;
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "raylib.h"
+
+/**
+ * Handle to a proxy registered with a Broadphase.
+ */
+using ProxyId = uint32_t;
+constexpr ProxyId NullProxy = UINT32_MAX;
+
+/**
+ * A candidate pair reported by the broadphase. Both sides passed the layer/mask
+ * filter and their bounds overlap; the narrowphase decides what actually happens.
+ */
+struct BroadphasePair
+{
+	void* userDataA;
+	void* userDataB;
+};
+
+/**
+ * Which broadphase implementation a scene should use.
+ */
+enum class BroadphaseType
+{
+	BruteForce,    // O(n^2), fine for a handful of proxies
+	SweepAndPrune, // Incremental sort along X, best for clustered scenes
+};
+
+/**
+ * Common interface for broadphase collision structures.
+ *
+ * Proxies are persistent between ticks: create one when an object spawns, move it
+ * every tick and destroy it on despawn, so implementations can exploit temporal coherence.
+ */
+class Broadphase
+{
+public:
+	virtual ~Broadphase() = default;
+
+	/**
+	 * Register a new proxy.
+	 * @param bounds World-space AABB of the object.
+	 * @param layer CollisionLayer bit of the object.
+	 * @param mask Layers the object reacts to.
+	 * @param userData Opaque pointer handed back in reported pairs.
+	 * @return Handle used to move or destroy the proxy.
+	 */
+	virtual ProxyId CreateProxy(const Rectangle& bounds, uint32_t layer, uint32_t mask, void* userData) = 0;
+	virtual void MoveProxy(ProxyId id, const Rectangle& bounds) = 0;
+	virtual void DestroyProxy(ProxyId id) = 0;
+
+	/**
+	 * Append every overlapping pair whose layers accept each other to `pairs`.
+	 * A pair is accepted when either side's mask contains the other's layer.
+	 */
+	virtual void QueryPairs(std::vector<BroadphasePair>& pairs) = 0;
+
+	/**
+	 * Append the userData of every proxy overlapping `region` to `out`, whatever its layer.
+	 * Touching edges count as overlap.
+	 */
+	virtual void QueryRegion(const Rectangle& region, std::vector<void*>& out) = 0;
+
+	/**
+	 * Append the userData of the (at most) `limit` proxies on `layers` overlapping
+	 * `region` whose centres are closest to the region's centre, closest first.
+	 * Touching edges count as overlap.
+	 */
+	virtual void QueryNearby(const Rectangle& region, uint32_t layers, size_t limit, std::vector<void*>& out) = 0;
+
+	virtual size_t GetProxyCount() const = 0;
+};
+
+/**
+ * Create a broadphase of the given type.
+ */
+std::unique_ptr<Broadphase> CreateBroadphase(BroadphaseType type);
@@ -0,0 +1,35 @@
+#pragma once
+#include <utility>
+#include <vector>
+
+#include "Physics/Broadphase.h"
+
+/**
+ * Reference broadphase that tests every proxy against every other one.
+ *
+ * Still rejects disallowed layer pairs before the bounds test. Useful for tiny
+ * scenes and as a correctness baseline for the other implementations.
+ */
+class BruteForceBroadphase : public Broadphase
+{
+public:
+	ProxyId CreateProxy(const Rectangle& bounds, uint32_t layer, uint32_t mask, void* userData) override;
+	void MoveProxy(ProxyId id, const Rectangle& bounds) override;
+	void DestroyProxy(ProxyId id) override;
+	void QueryPairs(std::vector<BroadphasePair>& pairs) override;
+	void QueryRegion(const Rectangle& region, std::vector<void*>& out) override;
+	void QueryNearby(const Rectangle& region, uint32_t layers, size_t limit, std::vector<void*>& out) override;
+	size_t GetProxyCount() const override { return m_Proxies.size() - m_FreeList.size(); }
+private:
+	struct Proxy
+	{
+		Rectangle bounds;
+		uint32_t layer;
+		uint32_t mask;
+		void* userData;
+	};
+
+	std::vector<Proxy> m_Proxies;
+	std::vector<ProxyId> m_FreeList;
+	std::vector<std::pair<float, ProxyId>> m_Nearest; // QueryNearby's best so far by squared distance, then id; reused
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Collision layer bits.
+ *
+ * Every entity lives on exactly one layer and carries a mask of the layers it
+ * reacts to. A pair is only worth testing when `mask & otherLayer` is non-zero,
+ * so friendly fire and bullet-vs-bullet pairs are rejected with a single AND
+ * before any position or texture is touched. Enemies do pair with each other, but
+ * only so the PushboxSolver can keep crowds apart; same-layer pairs never hit.
+ */
+namespace CollisionLayer
+{
+	enum : uint32_t
+	{
+		None             = 0,
+		Player           = 1u << 0,
+		Enemy            = 1u << 1,
+		PlayerProjectile = 1u << 2,
+		EnemyProjectile  = 1u << 3,
+		Item             = 1u << 4,
+		Static           = 1u << 5,
+
+		Pushable         = Player | Enemy, // Bodies separated by the PushboxSolver
+	};
+
+	constexpr uint32_t LayerCount = 6; // Bits in use above; EntityHot stores layers and masks in a byte
+
+	/**
+	 * Default row of the layer/mask matrix.
+	 * @param layer A single CollisionLayer bit.
+	 * @return Mask of the layers an entity on `layer` should collide with.
+	 */
+	constexpr uint32_t DefaultMask(uint32_t layer)
+	{
+		switch (layer)
+		{
+		case Player:           return Enemy | EnemyProjectile | Item | Static;
+		case Enemy:            return Player | Enemy | PlayerProjectile | Static;
+		case PlayerProjectile: return Enemy | Static;
+		case EnemyProjectile:  return Player | Static;
+		case Item:             return Player;
+		case Static:           return Player | Enemy | PlayerProjectile | EnemyProjectile;
+		default:               return None;
+		}
+	}
+
+	/**
+	 * Check that the matrix is symmetric over the first `count` layer bits.
+	 */
+	constexpr bool IsSymmetric(uint32_t count = LayerCount)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			for (uint32_t j = 0; j < count; j++)
+				if (((DefaultMask(1u << i) & (1u << j)) != 0) != ((DefaultMask(1u << j) & (1u << i)) != 0))
+					return false;
+		return true;
+	}
+}
+
+// An asymmetric matrix would keep or drop a pair depending on which side runs the test.
+static_assert(CollisionLayer::IsSymmetric(), "Collision mask matrix must be symmetric");
+static_assert(!(CollisionLayer::DefaultMask(CollisionLayer::PlayerProjectile) & (CollisionLayer::Player | CollisionLayer::PlayerProjectile)),
+	"Player projectiles must never hit their own side");
+static_assert(!(CollisionLayer::DefaultMask(CollisionLayer::EnemyProjectile) & (CollisionLayer::Enemy | CollisionLayer::EnemyProjectile)),
+	"Enemy projectiles must never hit their own side");
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Physics/Broadphase.h"
+
+class Entity;
+
+/**
+ * Pushbox separation for fighters, so bodies can't stand inside each other.
+ *
+ * Solve takes the tick's broadphase pairs, keeps those between two living bodies on
+ * pushable layers (CollisionLayer::Pushable), and separates them with a batched
+ * Jacobi solver. Every iteration measures all contacts from the same positions, in
+ * one SSE pass over structure-of-arrays contact data, then moves each body by the
+ * average of its corrections. Each overlapping pair is split evenly along its axis
+ * of least penetration.
+ *
+ * Pairs and bodies are sorted by EntityId first, so the result depends only on the
+ * world state and not on the order the broadphase reported the pairs. Dense crowds
+ * may be left slightly overlapping after MaxIterations; the rest is resolved over
+ * the following ticks.
+ */
+
+/**
+ * Separate every overlapping pushbox pair.
+ * @param pairs Broadphase pairs of the tick; pairs that aren't two living pushable bodies are ignored.
+ * @return Number of iterations run; zero if nothing overlapped.
+ */
+
+/**
+ * Bodies the last Solve touched, sorted by EntityId; their broadphase proxies need syncing.
+ */
+class PushboxSolver
+{
+public:
+	static constexpr uint32_t MaxIterations = 4;
+	static constexpr float Slop = 0.01f; // Penetration left alone, in units
+
+	uint32_t Solve(const std::vector<BroadphasePair>& pairs);
+	const std::vector<Entity*>& GetBodies() const { return m_Bodies; }
+private:
+	struct Contact
+	{
+		Entity* a; // Lower EntityId
+		Entity* b;
+	};
+
+	bool SolveContacts(); // One iteration; false once nothing overlaps beyond Slop
+
+	std::vector<Contact> m_Contacts;
+	std::vector<Entity*> m_Bodies;
+
+	// Per body
+	std::vector<float> m_CenterX;
+	std::vector<float> m_CenterY;
+	std::vector<float> m_HalfX;
+	std::vector<float> m_HalfY;
+	std::vector<float> m_DeltaX; // Sum of this iteration's corrections
+	std::vector<float> m_DeltaY;
+	std::vector<float> m_Share; // 1 / number of contacts
+
+	// Per contact, padded to a multiple of four
+	std::vector<uint32_t> m_BodyA;
+	std::vector<uint32_t> m_BodyB;
+	std::vector<float> m_ReachX; // Sum of both half extents
+	std::vector<float> m_ReachY;
+	std::vector<float> m_DX; // Centre of b minus centre of a
+	std::vector<float> m_DY;
+	std::vector<float> m_PushX; // Correction applied to b, and negated to a
+	std::vector<float> m_PushY;
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+/**
+ * Bounding volume hierarchy over static, axis-aligned colliders.
+ *
+ * Built once when a level loads and never modified afterwards. Nodes live in one
+ * flat array in depth-first order: an interior node's left child is the next node
+ * and only the right child index is stored, so a query walks memory mostly forwards.
+ * Leaves reference a contiguous range of the reordered collider array.
+ */
+class StaticBVH
+{
+public:
+	void Build(std::vector<Rectangle> colliders);
+	void Clear();
+
+	/**
+	 * Invoke `fn(const Rectangle&)` for every collider overlapping `box`.
+	 * Touching edges count as overlap, matching Entity::CheckCollision.
+	 */
+	template<typename Fn>
+	void Query(const Rectangle& box, Fn&& fn) const
+	{
+		if (m_Nodes.empty()) return;
+
+		const float minX = box.x, maxX = box.x + box.width;
+		const float minY = box.y, maxY = box.y + box.height;
+
+		uint32_t stack[MaxDepth];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const uint32_t index = stack[--top];
+			const Node& node = m_Nodes[index];
+			if (node.maxX < minX || maxX < node.minX || node.maxY < minY || maxY < node.minY)
+				continue;
+
+			if (node.count > 0)
+			{
+				for (uint32_t i = node.rightOrFirst; i < node.rightOrFirst + node.count; i++)
+				{
+					const Rectangle& collider = m_Colliders[i];
+					if (collider.x + collider.width < minX || maxX < collider.x)
+						continue;
+					if (collider.y + collider.height < minY || maxY < collider.y)
+						continue;
+					fn(collider);
+				}
+				continue;
+			}
+
+			stack[top++] = node.rightOrFirst;
+			stack[top++] = index + 1;
+		}
+	}
+
+	const std::vector<Rectangle>& GetColliders() const { return m_Colliders; }
+	size_t GetNodeCount() const { return m_Nodes.size(); }
+	bool IsEmpty() const { return m_Colliders.empty(); }
+private:
+	struct Node
+	{
+		float minX, minY, maxX, maxY;
+		uint32_t rightOrFirst; // Interior: right child index. Leaf: first collider
+		uint32_t count; // 0 for interior nodes
+	};
+
+	static constexpr uint32_t LeafSize = 4;
+	static constexpr int MaxDepth = 64;
+
+	void BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count);
+
+	std::vector<Node> m_Nodes;
+	std::vector<Rectangle> m_Colliders;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <utility>
+#include <vector>
+
+#include "Physics/Broadphase.h"
+
+/**
+ * Sweep-and-prune broadphase along the X axis.
+ *
+ * Proxies are kept in an array sorted by their minimum X. The order survives
+ * between ticks and is repaired with an insertion sort, which is close to O(n)
+ * when objects barely move. The sweep only walks forward while intervals overlap
+ * on X, so fighters and projectiles packed into a narrow horizontal band stay cheap.
+ * Region queries binary-search the same order, so they only touch proxies near the
+ * region on X. Nearby queries walk outwards from the region's centre in both directions
+ * and stop as soon as no interval left on either side can have its centre closer than
+ * the nearest results found so far.
+ */
+class SweepAndPrune : public Broadphase
+{
+public:
+	ProxyId CreateProxy(const Rectangle& bounds, uint32_t layer, uint32_t mask, void* userData) override;
+	void MoveProxy(ProxyId id, const Rectangle& bounds) override;
+	void DestroyProxy(ProxyId id) override;
+	void QueryPairs(std::vector<BroadphasePair>& pairs) override;
+	void QueryRegion(const Rectangle& region, std::vector<void*>& out) override;
+	void QueryNearby(const Rectangle& region, uint32_t layers, size_t limit, std::vector<void*>& out) override;
+	size_t GetProxyCount() const override { return m_Proxies.size() - m_FreeList.size() - m_PendingFree.size(); }
+private:
+	static constexpr size_t NearbyChunk = 16; // Intervals QueryNearby filters per step
+
+	struct Proxy
+	{
+		Rectangle bounds;
+		uint32_t layer;
+		uint32_t mask;
+		void* userData;
+		bool alive;
+	};
+
+	// Sorted entry; a copy of the proxy data so the sweep never leaves this array
+	struct Interval
+	{
+		float minX, maxX;
+		float minY, maxY;
+		uint32_t layer;
+		uint32_t mask;
+		ProxyId id;
+	};
+
+	void Refresh(); // Compact removals, append new proxies, copy moved bounds and sort
+	void Sort(); // Insertion sort, cheap on nearly-sorted input
+
+	std::vector<Proxy> m_Proxies;
+	std::vector<Interval> m_Intervals;
+	std::vector<ProxyId> m_Added; // Created since the last query
+	std::vector<ProxyId> m_PendingFree; // Destroyed but still referenced by m_Intervals
+	std::vector<ProxyId> m_FreeList;
+	std::vector<std::pair<float, ProxyId>> m_Nearest; // QueryNearby's best so far by squared distance, then id; reused
+	float m_MaxWidth = 0; // Widest interval, bounds how far left of a region a query starts
+	bool m_Dirty = false; // A proxy was created, moved or destroyed since the last Refresh
+};
@@ -0,0 +1,150 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+#include "Render/TextureCache.h"
+
+class Entity;
+
+/**
+ * Handle to a clip in the AnimationLibrary.
+ */
+using ClipId = uint16_t;
+
+/**
+ * States of the per-entity animation state machine. Each archetype maps every state
+ * to a clip, so changing state (and direction) is an index change.
+ */
+enum class AnimState : uint8_t
+{
+	Idle,
+	WalkLeft,
+	WalkRight,
+	Up,
+	Attack, // One-shot: plays once, then returns to the last looping state
+	Count
+};
+
+constexpr size_t AnimStateCount = static_cast<size_t>(AnimState::Count);
+
+/**
+ * A run of frames on one texture, played at a fixed rate.
+ */
+struct AnimationClip
+{
+	TextureId texture;
+	uint32_t firstFrame; // Index of the first frame rectangle in the library's frame table
+	uint16_t frameCount;
+	uint16_t ticksPerFrame;
+	bool loop; // Looping clips wrap; one-shot clips hold their last frame until replaced
+};
+
+/**
+ * Clip of every AnimState for one archetype.
+ */
+struct AnimationSet
+{
+	ClipId clips[AnimStateCount];
+
+	ClipId operator[](AnimState state) const { return clips[static_cast<size_t>(state)]; }
+};
+
+/**
+ * Process-wide clip and frame-rectangle tables.
+ *
+ * Clips are cut out of their sprite sheets once, when archetypes resolve, so playing
+ * a frame is a table lookup. Loads textures, so clips are only added on the window thread.
+ */
+
+/**
+ * Add a clip whose frames sit side by side on a sheet.
+ * @param texture Sprite sheet.
+ * @param firstFrame Source rectangle of the first frame; each next frame is one width to the right.
+ * @param frameCount Number of frames.
+ * @param ticksPerFrame Simulation ticks each frame stays up.
+ * @param loop Whether the clip wraps around.
+ * @return Handle of the clip.
+ */
+
+/**
+ * Add a clip that fills a whole texture as a single horizontal strip of equal frames.
+ * @param path Texture file; loaded through the TextureCache.
+ * @param frameCount Number of frames across the texture.
+ * @param ticksPerFrame Simulation ticks each frame stays up.
+ * @param loop Whether the clip wraps around.
+ * @return Handle of the clip.
+ */
+class AnimationLibrary
+{
+public:
+	static ClipId AddClip(TextureId texture, const Rectangle& firstFrame, uint16_t frameCount, uint16_t ticksPerFrame, bool loop);
+	static ClipId AddStrip(const char* path, uint16_t frameCount, uint16_t ticksPerFrame, bool loop);
+
+	static const AnimationClip& GetClip(ClipId id) { return s_Clips[id]; }
+	static const Rectangle& GetFrame(uint32_t index) { return s_Frames[index]; }
+private:
+	static std::vector<AnimationClip> s_Clips;
+	static std::vector<Rectangle> s_Frames;
+};
+
+/**
+ * Playback state of one entity: its set, the clip playing and where in it.
+ */
+struct Animator
+{
+	const AnimationSet* set;
+	ClipId clip;
+	uint16_t frame; // Frame within the clip
+	uint16_t ticksLeft; // Ticks until the next frame
+	AnimState state; // State whose clip is playing
+	AnimState base; // Looping state to return to after a one-shot
+
+	/**
+	 * Switch the looping state. Restarts only if the clip changes, and never cuts
+	 * a one-shot short: it is picked up when the one-shot ends.
+	 */
+	void SetState(AnimState next)
+	{
+		base = next;
+		if (next != state && AnimationLibrary::GetClip(clip).loop)
+			Play(next);
+	}
+
+	/**
+	 * Start a state's clip from its first frame, replacing whatever is playing.
+	 */
+	void Play(AnimState next)
+	{
+		state = next;
+		clip = (*set)[next];
+		frame = 0;
+		ticksLeft = AnimationLibrary::GetClip(clip).ticksPerFrame;
+	}
+
+	const Rectangle& GetSource() const { return AnimationLibrary::GetFrame(AnimationLibrary::GetClip(clip).firstFrame + frame); }
+	TextureId GetTexture() const { return AnimationLibrary::GetClip(clip).texture; }
+};
+
+static_assert(sizeof(Animator) == 16, "Animator should stay four per cache line");
+
+/**
+ * Dense, process-wide array of Animators, one per Entity.
+ *
+ * Works like the EntityStore: releasing a slot moves the last animator into it, so
+ * Advance streams through every animated entity in one pass without touching them.
+ */
+class AnimationStore
+{
+public:
+	static uint32_t Allocate(Entity* owner, const AnimationSet& set);
+	static void Release(uint32_t index);
+
+	static Animator& Get(uint32_t index) { return s_Animators[index]; }
+
+	static void Advance();
+private:
+	static std::vector<Animator> s_Animators;
+	static std::vector<Entity*> s_Owners; // Parallel to s_Animators, to patch indices on release
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+#include "Render/TextureCache.h"
+
+/**
+ * One textured quad: `source` (the whole texture if empty) stretched over `dest`.
+ */
+struct SpriteCommand
+{
+	Rectangle dest;
+	Rectangle source;
+	TextureId texture;
+};
+
+/**
+ * Immutable picture of one simulation tick, as the render thread sees it.
+ *
+ * The simulation records it at the end of a tick and publishes it through a
+ * TripleBuffer; the renderer only reads it, never the entities themselves.
+ */
+struct RenderSnapshot
+{
+	uint64_t tick = 0; // Simulation tick this snapshot was recorded in
+	std::vector<SpriteCommand> sprites; // In draw order
+
+	void Clear() { sprites.clear(); }
+	void Sprite(const Rectangle& dest, TextureId texture) { sprites.push_back({ dest, {}, texture }); }
+	void Sprite(const Rectangle& dest, TextureId texture, const Rectangle& source) { sprites.push_back({ dest, source, texture }); }
+	void Draw() const;
+};
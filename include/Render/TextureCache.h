@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "raylib.h"
+
+/**
+ * Small integer handle to a texture in the TextureCache.
+ */
+using TextureId = uint16_t;
+
+/**
+ * Cold side table of render resources.
+ *
+ * Every texture is loaded once per path and shared by all entities that use it;
+ * entities only store a TextureId, so switching sprites is an integer assignment
+ * and no GPU resource is ever copied into an entity.
+ */
+class TextureCache
+{
+public:
+	static TextureId Load(const char* path);
+	static void SetHeadless(bool headless) { s_Headless = headless; }
+	static bool IsHeadless() { return s_Headless; }
+	static const Texture2D& Get(TextureId id) { return s_Textures[id]; }
+	static void UnloadAll();
+private:
+	static std::vector<Texture2D> s_Textures;
+	static std::unordered_map<std::string, TextureId> s_Ids;
+	static bool s_Headless; // No GPU: textures only carry their size
+};
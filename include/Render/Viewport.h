@@ -0,0 +1,40 @@
+#pragma once
+#include "raylib.h"
+
+/**
+ * The part of the world the window shows, in world coordinates.
+ *
+ * The simulation records only what overlaps the view into a RenderSnapshot, so
+ * offscreen sprites never reach the render thread. A second, larger rectangle (the
+ * view grown by `lodMargin` on every side) separates entities that are merely
+ * offscreen from those far enough away to be simulated at a reduced rate.
+ */
+class Viewport
+{
+public:
+	Viewport(const Rectangle& view, float lodMargin)
+		: m_View(view),
+		m_LodRegion{ view.x - lodMargin, view.y - lodMargin, view.width + 2 * lodMargin, view.height + 2 * lodMargin }
+	{}
+
+	const Rectangle& GetView() const { return m_View; }
+	const Rectangle& GetLodRegion() const { return m_LodRegion; }
+
+	/**
+	 * Whether any part of `box` is on screen. Touching edges count, as in the broadphase.
+	 */
+	bool IsVisible(const Rectangle& box) const { return Overlaps(m_View, box); }
+
+	/**
+	 * Whether `box` is far enough outside the view to be simulated at a reduced rate.
+	 */
+	bool IsFar(const Rectangle& box) const { return !Overlaps(m_LodRegion, box); }
+private:
+	static bool Overlaps(const Rectangle& a, const Rectangle& b)
+	{
+		return !(b.x + b.width < a.x || a.x + a.width < b.x || b.y + b.height < a.y || a.y + a.height < b.y);
+	}
+
+	Rectangle m_View;
+	Rectangle m_LodRegion;
+};
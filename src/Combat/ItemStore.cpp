@@ -0,0 +1,129 @@
+#include "Combat/ItemStore.h"
+#include "Core/EventLog.h"
+
+TextureId ItemStore::s_Textures[FrameData::WeaponCount] = {};
+
+namespace
+{
+	// Indexed by WeaponId; bare hands never lie on the floor
+	constexpr const char* ItemSprites[] =
+	{
+		nullptr, // Fists
+		"resources/Items/knife.png",
+		"resources/Items/brokenbottle.png",
+	};
+
+	static_assert(sizeof(ItemSprites) / sizeof(ItemSprites[0]) == FrameData::WeaponCount, "ItemSprites must have one entry per WeaponId");
+}
+
+/**
+ * @brief Loads the sprite of every weapon that can lie on the floor.
+ */
+void ItemStore::LoadTextures()
+{
+	for (size_t i = 0; i < FrameData::WeaponCount; i++)
+	{
+		if (ItemSprites[i])
+			s_Textures[i] = TextureCache::Load(ItemSprites[i]);
+	}
+}
+
+/**
+ * @brief Chains every slot into the free list.
+ */
+ItemStore::ItemStore()
+{
+	for (size_t i = 0; i < Capacity; i++)
+	{
+		m_Items[i] = {};
+		m_Items[i].next = i + 1 < Capacity ? static_cast<ItemId>(i + 1) : NullItem;
+	}
+}
+
+/**
+ * @brief Takes a free slot and links the item into the cell holding its centre.
+ *
+ * @param weapon Weapon the item gives; Fists is rejected.
+ * @param center World-space centre of the item.
+ * @return Handle of the new item, or NullItem if the pool is full.
+ */
+ItemId ItemStore::Spawn(FrameData::WeaponId weapon, Vector2 center)
+{
+	if (weapon == FrameData::WeaponId::Fists) return NullItem;
+	if (m_FreeHead == NullItem)
+	{
+		EventLog::Log<LogLevel::Warn>(LogCategory::Combat, "Item pool full, dropping item at ({:.0f}, {:.0f})", center.x, center.y);
+		return NullItem;
+	}
+
+	const ItemId id = m_FreeHead;
+	Item& item = m_Items[id];
+	m_FreeHead = item.next;
+
+	constexpr float Half = ItemSize * 0.5f;
+	item.bounds = { center.x - Half, center.y - Half, ItemSize, ItemSize };
+	item.weapon = weapon;
+	item.alive = true;
+
+	ItemId& head = m_Cells.try_emplace(CellKey(CellOf(center.x), CellOf(center.y)), NullItem).first->second;
+	item.next = head;
+	head = id;
+	m_Count++;
+	return id;
+}
+
+/**
+ * @brief Unlinks an item from its cell and returns its slot to the free list.
+ *
+ * @param id Handle of a live item.
+ */
+void ItemStore::Remove(ItemId id)
+{
+	Item& item = m_Items[id];
+	if (!item.alive) return;
+
+	const float centerX = item.bounds.x + item.bounds.width * 0.5f;
+	const float centerY = item.bounds.y + item.bounds.height * 0.5f;
+	auto cell = m_Cells.find(CellKey(CellOf(centerX), CellOf(centerY)));
+	ItemId* link = &cell->second;
+	while (*link != id)
+		link = &m_Items[*link].next;
+	*link = item.next;
+	if (cell->second == NullItem)
+		m_Cells.erase(cell);
+
+	item.alive = false;
+	item.next = m_FreeHead;
+	m_FreeHead = id;
+	m_Count--;
+}
+
+/**
+ * @brief Walks the grid cells under a region for the first item overlapping it.
+ *
+ * @param reach World-space region to search.
+ * @return Handle of an overlapping item, or NullItem.
+ */
+ItemId ItemStore::FindInRange(const Rectangle& reach) const
+{
+	ItemId found = NullItem;
+	Query(reach, [&](ItemId id, const Item&) {
+		found = id;
+		return true;
+	});
+	return found;
+}
+
+/**
+ * @brief Records every item in the view, found through the grid.
+ *
+ * @param out Snapshot to append to.
+ * @param view World-space rectangle on screen.
+ */
+void ItemStore::Record(RenderSnapshot& out, const Rectangle& view) const
+{
+	Query(view, [&](ItemId, const Item& item) {
+		out.Sprite(item.bounds, s_Textures[static_cast<size_t>(item.weapon)]);
+		return false;
+	});
+}
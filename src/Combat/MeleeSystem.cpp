@@ -0,0 +1,256 @@
+#include <limits>
+
+#include "Combat/MeleeSystem.h"
+#include "NPCs/Entity.h"
+#include "Physics/Broadphase.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MELEE_SIMD 1
+#endif
+
+namespace
+{
+	/**
+	 * Place a FrameData box on a fighter, mirroring it if the fighter faces left.
+	 */
+	Rectangle toWorld(const Rectangle& box, const Rectangle& bounds, bool facingLeft)
+	{
+		const float x = facingLeft ? bounds.width - box.x - box.width : box.x;
+		return { bounds.x + x, bounds.y + box.y, box.width, box.height };
+	}
+}
+
+/**
+ * @brief Registers a fighter, idle.
+ *
+ * @param fighter Entity to attach.
+ * @param stats FrameData entry of the fighter.
+ */
+void MeleeSystem::Attach(Entity& fighter, FrameData::FighterId stats)
+{
+	Combatant combatant{};
+	combatant.entity = &fighter;
+	combatant.stats = stats;
+	m_Index[fighter.GetId()] = static_cast<uint32_t>(m_Combatants.size());
+	m_Combatants.push_back(combatant);
+}
+
+/**
+ * @brief Removes a fighter; the last fighter takes its slot.
+ *
+ * @param fighter Entity that is about to be destroyed.
+ */
+void MeleeSystem::Detach(const Entity& fighter)
+{
+	auto it = m_Index.find(fighter.GetId());
+	if (it == m_Index.end()) return;
+
+	const uint32_t slot = it->second;
+	m_Index.erase(it);
+	if (slot + 1 != m_Combatants.size())
+	{
+		m_Combatants[slot] = m_Combatants.back();
+		m_Index[m_Combatants[slot].entity->GetId()] = slot;
+	}
+	m_Combatants.pop_back();
+}
+
+/**
+ * @brief Starts a move from its first frame and clears the attack's hit list.
+ *
+ * Attacks can't be cancelled: a fighter still in a move keeps performing it.
+ *
+ * @param fighter Attached fighter.
+ * @param move Melee move to perform.
+ * @param facingLeft Mirror the move's boxes.
+ * @return true if the attack started.
+ */
+bool MeleeSystem::StartAttack(const Entity& fighter, FrameData::MoveId move, bool facingLeft)
+{
+	auto it = m_Index.find(fighter.GetId());
+	if (it == m_Index.end()) return false;
+
+	Combatant& combatant = m_Combatants[it->second];
+	if (combatant.attacking) return false;
+
+	combatant.move = move;
+	combatant.frame = 0;
+	combatant.attacking = true;
+	combatant.facingLeft = facingLeft;
+	combatant.hitCount = 0;
+	return true;
+}
+
+/**
+ * @brief Writes every living fighter's hurtboxes for this tick into the packed arrays.
+ *
+ * Fighters in a move use the hurtboxes of its current frame, idle fighters those of
+ * their FrameData entry. Three never-overlapping boxes (min +inf, max -inf) pad the
+ * end, so the last fighter can be read four boxes at a time.
+ */
+void MeleeSystem::PackHurtboxes()
+{
+	m_HurtMinX.clear();
+	m_HurtMinY.clear();
+	m_HurtMaxX.clear();
+	m_HurtMaxY.clear();
+
+	for (Combatant& combatant : m_Combatants)
+	{
+		combatant.hurtFirst = static_cast<uint32_t>(m_HurtMinX.size());
+		combatant.hurtCount = 0;
+		if (!combatant.entity->IsAlive()) continue;
+
+		const FrameData::BoxRange range = combatant.attacking
+			? FrameData::GetFrame(combatant.move, combatant.frame).hurt
+			: FrameData::GetFighter(combatant.stats).hurt;
+		const Rectangle bounds = combatant.entity->GetBounds();
+		for (const Rectangle& box : FrameData::GetBoxes(range))
+		{
+			const Rectangle world = toWorld(box, bounds, combatant.attacking && combatant.facingLeft);
+			m_HurtMinX.push_back(world.x);
+			m_HurtMinY.push_back(world.y);
+			m_HurtMaxX.push_back(world.x + world.width);
+			m_HurtMaxY.push_back(world.y + world.height);
+		}
+		combatant.hurtCount = range.count;
+	}
+
+	constexpr float Inf = std::numeric_limits<float>::infinity();
+	for (int i = 0; i < 3; i++)
+	{
+		m_HurtMinX.push_back(Inf);
+		m_HurtMinY.push_back(Inf);
+		m_HurtMaxX.push_back(-Inf);
+		m_HurtMaxY.push_back(-Inf);
+	}
+}
+
+/**
+ * @brief Tests one hitbox against every hurtbox of a target.
+ *
+ * Runs four hurtboxes per step; lanes past the target's own boxes are masked off.
+ * Touching edges count as overlap, like Entity::CheckCollision.
+ *
+ * @param hit World-space hitbox.
+ * @param target Fighter whose packed hurtboxes to test.
+ * @return true if any hurtbox overlaps.
+ */
+bool MeleeSystem::Overlaps(const Rectangle& hit, const Combatant& target) const
+{
+	const float right = hit.x + hit.width;
+	const float bottom = hit.y + hit.height;
+	const uint32_t end = target.hurtFirst + target.hurtCount;
+	uint32_t i = target.hurtFirst;
+#ifdef MELEE_SIMD
+	const __m128 left4 = _mm_set1_ps(hit.x);
+	const __m128 top4 = _mm_set1_ps(hit.y);
+	const __m128 right4 = _mm_set1_ps(right);
+	const __m128 bottom4 = _mm_set1_ps(bottom);
+	for (; i < end; i += 4)
+	{
+		const __m128 overlapX = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_HurtMinX.data() + i), right4),
+			_mm_cmpge_ps(_mm_loadu_ps(m_HurtMaxX.data() + i), left4));
+		const __m128 overlapY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_HurtMinY.data() + i), bottom4),
+			_mm_cmpge_ps(_mm_loadu_ps(m_HurtMaxY.data() + i), top4));
+		const uint32_t lanes = end - i < 4 ? end - i : 4;
+		if (_mm_movemask_ps(_mm_and_ps(overlapX, overlapY)) & ((1 << lanes) - 1))
+			return true;
+	}
+	return false;
+#else
+	for (; i < end; i++)
+	{
+		if (m_HurtMinX[i] <= right && m_HurtMaxX[i] >= hit.x && m_HurtMinY[i] <= bottom && m_HurtMaxY[i] >= hit.y)
+			return true;
+	}
+	return false;
+#endif
+}
+
+/**
+ * @brief Lands every hit of the tick.
+ *
+ * For each living fighter on an active frame, its hitboxes are taken HitboxChunk at a
+ * time and the union of each chunk is sent to the broadphase as a region query.
+ * Candidates that are attached fighters, on another layer the attacker's mask accepts
+ * and not yet hit by this attack have their hurtboxes tested against each hitbox of
+ * the chunk. A hit applies the move's damage, queues a Debug-level Combat event and is
+ * added to the attack's hit list.
+ *
+ * @param broadphase Broadphase with up-to-date proxies for every fighter.
+ * @return Number of hits landed.
+ */
+uint32_t MeleeSystem::Resolve(Broadphase& broadphase)
+{
+	PackHurtboxes();
+
+	uint32_t hits = 0;
+	for (Combatant& attacker : m_Combatants)
+	{
+		if (!attacker.attacking || !attacker.entity->IsAlive()) continue;
+		const FrameData::BoxList hitboxes = FrameData::GetBoxes(FrameData::GetFrame(attacker.move, attacker.frame).hit);
+		if (hitboxes.empty() || attacker.hitCount == MaxTargetsPerAttack) continue;
+
+		const Rectangle bounds = attacker.entity->GetBounds();
+		const float damage = FrameData::GetMove(attacker.move).damage;
+		for (uint32_t chunk = 0; chunk < hitboxes.count && attacker.hitCount < MaxTargetsPerAttack; chunk += HitboxChunk)
+		{
+			Rectangle worldHits[HitboxChunk];
+			const uint32_t hitCount = hitboxes.count - chunk < HitboxChunk ? hitboxes.count - chunk : HitboxChunk;
+			float minX = std::numeric_limits<float>::infinity(), minY = minX, maxX = -minX, maxY = -minX;
+			for (uint32_t h = 0; h < hitCount; h++)
+			{
+				const Rectangle& world = worldHits[h] = toWorld(hitboxes.first[chunk + h], bounds, attacker.facingLeft);
+				minX = world.x < minX ? world.x : minX;
+				minY = world.y < minY ? world.y : minY;
+				maxX = world.x + world.width > maxX ? world.x + world.width : maxX;
+				maxY = world.y + world.height > maxY ? world.y + world.height : maxY;
+			}
+
+			m_Candidates.clear();
+			broadphase.QueryRegion({ minX, minY, maxX - minX, maxY - minY }, m_Candidates);
+			for (void* candidate : m_Candidates)
+			{
+				Entity& target = *static_cast<Entity*>(candidate);
+				const uint32_t layer = target.GetCollisionLayer();
+				if (&target == attacker.entity || !target.IsAlive() || layer == attacker.entity->GetCollisionLayer() || !attacker.entity->CollidesWithLayer(layer))
+					continue;
+
+				auto it = m_Index.find(target.GetId());
+				if (it == m_Index.end()) continue;
+				bool alreadyHit = false;
+				for (uint8_t i = 0; i < attacker.hitCount; i++)
+					alreadyHit = alreadyHit || attacker.hits[i] == target.GetId();
+				if (alreadyHit) continue;
+
+				const Combatant& defender = m_Combatants[it->second];
+				bool landed = false;
+				for (uint32_t h = 0; h < hitCount && !landed; h++)
+					landed = Overlaps(worldHits[h], defender);
+				if (!landed) continue;
+
+				target.TakeDamage(damage);
+				EventLog::Log<LogLevel::Debug>(LogCategory::Combat, "Melee hit for {:.0f} damage, {:.0f} hp left", damage, target.GetHp());
+				attacker.hits[attacker.hitCount++] = target.GetId();
+				hits++;
+				if (attacker.hitCount == MaxTargetsPerAttack) break;
+			}
+		}
+	}
+	return hits;
+}
+
+/**
+ * @brief Advances every attack by a frame; attacks past their last recovery frame end.
+ */
+void MeleeSystem::Advance()
+{
+	for (Combatant& combatant : m_Combatants)
+	{
+		if (!combatant.attacking) continue;
+		if (++combatant.frame >= FrameData::GetMove(combatant.move).TotalFrames())
+			combatant.attacking = false;
+	}
+}
@@ -0,0 +1,100 @@
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "Core/AllocationCounter.h"
+
+namespace
+{
+	thread_local uint64_t t_Allocations = 0;
+
+	void* Allocate(std::size_t size)
+	{
+		t_Allocations++;
+		return std::malloc(size ? size : 1);
+	}
+
+	// Over-allocates and keeps malloc's pointer just below the aligned block, since
+	// aligned_alloc has no portable counterpart to free with
+	void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+	{
+		const std::size_t align = static_cast<std::size_t>(alignment);
+		void* raw = Allocate(size + align + sizeof(void*));
+		if (!raw) return nullptr;
+
+		const std::uintptr_t start = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+		void** memory = reinterpret_cast<void**>((start + align - 1) & ~(std::uintptr_t{ align } - 1));
+		memory[-1] = raw;
+		return memory;
+	}
+
+	void FreeAligned(void* memory)
+	{
+		if (memory)
+			std::free(static_cast<void**>(memory)[-1]);
+	}
+}
+
+/**
+ * @brief Returns how many times the calling thread has called operator new.
+ */
+uint64_t AllocationCounter::ThisThread()
+{
+	return t_Allocations;
+}
+
+// Replacements of the global allocation functions, plain and over-aligned. The array
+// forms forward to these.
+void* operator new(std::size_t size)
+{
+	if (void* memory = Allocate(size))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return Allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+	std::free(memory);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	if (void* memory = AllocateAligned(size, alignment))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+	FreeAligned(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+	FreeAligned(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	FreeAligned(memory);
+}
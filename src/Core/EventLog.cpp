@@ -0,0 +1,129 @@
+#include <chrono>
+
+#include "spdlog/spdlog.h"
+#include "Core/EventLog.h"
+#include "Input/InputEvent.h"
+
+SpscRing<LogEvent, 4096> EventLog::s_Events;
+std::thread EventLog::s_Thread;
+std::atomic<bool> EventLog::s_Running{ false };
+double EventLog::s_Tokens[LogCategoryCount] = {};
+double EventLog::s_LastRefill[LogCategoryCount] = {};
+std::atomic<uint64_t> EventLog::s_Suppressed[LogCategoryCount] = {};
+std::atomic<uint64_t> EventLog::s_Dropped{ 0 };
+
+namespace
+{
+	struct CategoryInfo
+	{
+		const char* name;
+		double perSecond; // Sustained events per second
+		double burst; // Events allowed back to back
+	};
+
+	constexpr CategoryInfo CategoryInfos[LogCategoryCount] =
+	{
+		{ "collision", 20, 50 },
+		{ "combat", 20, 50 },
+	};
+
+	constexpr auto DrainPeriod = std::chrono::milliseconds(10);
+}
+
+/**
+ * @brief Launches the formatting thread.
+ */
+void EventLog::Start()
+{
+	if (s_Running.exchange(true)) return;
+	s_Thread = std::thread(&EventLog::Run);
+}
+
+/**
+ * @brief Stops the formatting thread; it drains the queue before exiting.
+ */
+void EventLog::Stop()
+{
+	if (!s_Running.exchange(false)) return;
+	s_Thread.join();
+}
+
+/**
+ * @brief Timestamps an event, applies its category's rate limit and queues it.
+ *
+ * The token bucket refills at the category's rate up to its burst size; an event
+ * that finds it empty is only counted. Never blocks: a full ring drops the event.
+ *
+ * @param event Event to queue; its time is filled in here.
+ */
+void EventLog::Push(LogEvent& event)
+{
+	const size_t category = static_cast<size_t>(event.category);
+	const CategoryInfo& info = CategoryInfos[category];
+
+	event.time = InputNow();
+	double& tokens = s_Tokens[category];
+	if (s_LastRefill[category] == 0)
+		tokens = info.burst;
+	else
+		tokens += (event.time - s_LastRefill[category]) * info.perSecond;
+	if (tokens > info.burst)
+		tokens = info.burst;
+	s_LastRefill[category] = event.time;
+
+	if (tokens < 1)
+	{
+		s_Suppressed[category].fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	tokens -= 1;
+
+	if (!s_Events.TryPush(event))
+		s_Dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Formatting thread body: drains the queue every DrainPeriod until stopped.
+ */
+void EventLog::Run()
+{
+	while (s_Running.load(std::memory_order_acquire))
+	{
+		Drain();
+		std::this_thread::sleep_for(DrainPeriod);
+	}
+	Drain();
+}
+
+/**
+ * @brief Formats every queued event through spdlog, then reports what was suppressed or dropped.
+ *
+ * Events below spdlog's runtime level are discarded without being formatted.
+ */
+void EventLog::Drain()
+{
+	const LogEvent* event;
+	while (s_Events.Peek(event))
+	{
+		const auto level = static_cast<spdlog::level::level_enum>(event->level);
+		if (!spdlog::should_log(level)) // Filtered at runtime: skip the formatting too
+		{
+			s_Events.Pop();
+			continue;
+		}
+
+		const std::string text = fmt::format(fmt::runtime(event->format),
+			event->args[0], event->args[1], event->args[2], event->args[3]);
+		spdlog::log(level, "[{:.4f}] [{}] {}",
+			event->time, CategoryInfos[static_cast<size_t>(event->category)].name, text);
+		s_Events.Pop();
+	}
+
+	for (size_t i = 0; i < LogCategoryCount; i++)
+	{
+		if (const uint64_t suppressed = s_Suppressed[i].exchange(0, std::memory_order_relaxed))
+			spdlog::info("[{}] {} events suppressed by rate limit", CategoryInfos[i].name, suppressed);
+	}
+	if (const uint64_t dropped = s_Dropped.exchange(0, std::memory_order_relaxed))
+		spdlog::warn("Event log queue full, {} events dropped", dropped);
+}
@@ -0,0 +1,190 @@
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "spdlog/spdlog.h"
+#include "Core/FlightRecorder.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#define FLIGHT_OPEN(path) _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644)
+#define FLIGHT_WRITE _write
+#define FLIGHT_CLOSE _close
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define FLIGHT_OPEN(path) open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)
+#define FLIGHT_WRITE write
+#define FLIGHT_CLOSE close
+#endif
+
+namespace
+{
+	std::atomic<FlightRecorder*> s_Active{ nullptr }; // Recorder the crash handler dumps
+	constexpr int CrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+	FlightFileHeader MakeHeader(uint32_t count, uint32_t tickMicros, FlightDumpReason reason)
+	{
+		FlightFileHeader header{};
+		std::memcpy(header.magic, FlightMagic, sizeof(header.magic));
+		header.version = FlightVersion;
+		header.recordSize = sizeof(TickRecord);
+		header.count = count;
+		header.tickMicros = tickMicros;
+		header.reason = reason;
+		return header;
+	}
+}
+
+/**
+ * @brief Stops the writer thread if it is still running.
+ */
+FlightRecorder::~FlightRecorder()
+{
+	Stop();
+}
+
+/**
+ * @brief Launches the writer thread and routes fatal signals to this recorder.
+ *
+ * @param tickMicros Nominal tick length, stored in dump headers.
+ */
+void FlightRecorder::Start(uint32_t tickMicros)
+{
+	if (m_Running) return;
+	m_TickMicros = tickMicros;
+	m_Running = true;
+	m_Thread = std::thread(&FlightRecorder::Run, this);
+
+	s_Active.store(this);
+	for (int signal : CrashSignals)
+		std::signal(signal, &FlightRecorder::OnCrash);
+}
+
+/**
+ * @brief Restores the default signal handlers and joins the writer thread.
+ */
+void FlightRecorder::Stop()
+{
+	if (!m_Running) return;
+
+	FlightRecorder* self = this;
+	if (s_Active.compare_exchange_strong(self, nullptr))
+	{
+		for (int signal : CrashSignals)
+			std::signal(signal, SIG_DFL);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Running = false;
+	}
+	m_Wake.notify_one();
+	m_Thread.join();
+}
+
+/**
+ * @brief Snapshots the ring and wakes the writer thread.
+ *
+ * Costs one copy of the ring on the calling (simulation) thread; the file is
+ * written by the writer thread.
+ *
+ * @param reason Stored in the dump header.
+ */
+void FlightRecorder::Dump(FlightDumpReason reason)
+{
+	if (!m_Running || m_DumpPending.load(std::memory_order_acquire)) return;
+	if (m_LastDump != 0 && m_Count - m_LastDump < Capacity / 2) return;
+	m_LastDump = m_Count;
+
+	const size_t count = CopyOrdered(m_DumpRecords);
+	m_DumpHeader = MakeHeader(static_cast<uint32_t>(count), m_TickMicros, reason);
+	m_DumpTick = count ? m_DumpRecords[count - 1].tick : 0;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_DumpPending.store(true, std::memory_order_release);
+	}
+	m_Wake.notify_one();
+}
+
+/**
+ * @brief Copies the ring into `out`, oldest record first.
+ *
+ * @param out Buffer of at least Capacity records.
+ * @return Number of records copied.
+ */
+size_t FlightRecorder::CopyOrdered(TickRecord* out) const
+{
+	if (m_Count <= Capacity)
+	{
+		std::memcpy(out, m_Records, m_Count * sizeof(TickRecord));
+		return static_cast<size_t>(m_Count);
+	}
+
+	const size_t oldest = m_Count & (Capacity - 1);
+	std::memcpy(out, m_Records + oldest, (Capacity - oldest) * sizeof(TickRecord));
+	std::memcpy(out + (Capacity - oldest), m_Records, oldest * sizeof(TickRecord));
+	return Capacity;
+}
+
+/**
+ * @brief Writer thread body: writes each handed-off dump to `flight-<tick>.bin`.
+ */
+void FlightRecorder::Run()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while (true)
+	{
+		m_Wake.wait(lock, [&] { return !m_Running || m_DumpPending.load(std::memory_order_acquire); });
+		if (!m_DumpPending.load(std::memory_order_acquire))
+			return; // Stopped with nothing left to write
+
+		lock.unlock();
+		const std::string path = "flight-" + std::to_string(m_DumpTick) + ".bin";
+		if (std::FILE* file = std::fopen(path.c_str(), "wb"))
+		{
+			std::fwrite(&m_DumpHeader, sizeof(m_DumpHeader), 1, file);
+			std::fwrite(m_DumpRecords, sizeof(TickRecord), m_DumpHeader.count, file);
+			std::fclose(file);
+			spdlog::warn("Frame hitch at tick {}, last {} ticks written to {}", m_DumpTick, m_DumpHeader.count, path);
+		}
+		else
+			spdlog::error("Couldn't write flight record '{}'", path);
+		lock.lock();
+
+		m_DumpPending.store(false, std::memory_order_release);
+	}
+}
+
+/**
+ * @brief Fatal signal handler: writes the live ring to `flight-crash.bin`, then re-raises.
+ *
+ * Only calls async-signal-safe functions and never copies the ring; the record being
+ * written when the signal hit may be torn.
+ *
+ * @param signal Signal being handled.
+ */
+void FlightRecorder::OnCrash(int signal)
+{
+	if (FlightRecorder* recorder = s_Active.exchange(nullptr))
+	{
+		const int fd = FLIGHT_OPEN("flight-crash.bin");
+		if (fd >= 0)
+		{
+			const uint64_t count = recorder->m_Count;
+			const size_t stored = count < Capacity ? static_cast<size_t>(count) : Capacity;
+			const FlightFileHeader header = MakeHeader(static_cast<uint32_t>(stored), recorder->m_TickMicros, FlightDumpReason::Crash);
+			FLIGHT_WRITE(fd, &header, sizeof(header));
+
+			const size_t oldest = count <= Capacity ? 0 : static_cast<size_t>(count & (Capacity - 1));
+			FLIGHT_WRITE(fd, recorder->m_Records + oldest, static_cast<unsigned>((stored - oldest) * sizeof(TickRecord)));
+			FLIGHT_WRITE(fd, recorder->m_Records, static_cast<unsigned>(oldest * sizeof(TickRecord)));
+			FLIGHT_CLOSE(fd);
+		}
+	}
+
+	std::signal(signal, SIG_DFL);
+	std::raise(signal);
+}
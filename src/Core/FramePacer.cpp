@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Core/FramePacer.h"
+#include "Input/InputEvent.h"
+
+/**
+ * @brief Constructs a pacer with the given interval; call Start before the first Wait.
+ *
+ * @param interval Seconds between deadlines.
+ */
+FramePacer::FramePacer(double interval)
+	: m_Interval(interval)
+{}
+
+/**
+ * @brief Schedules the first deadline one interval after `now`.
+ *
+ * @param now InputNow() time to start from.
+ */
+void FramePacer::Start(double now)
+{
+	m_Deadline = now + m_Interval;
+}
+
+/**
+ * @brief Sleeps, then spins, until `lead` seconds before the current deadline.
+ *
+ * Coarse sleeps stop SpinWindow short of the target; if an idle callback is given they
+ * are cut into IdleSlice pieces with a call in between. The final stretch is a busy
+ * wait on the steady clock. Lateness of the wake-up is recorded in microseconds.
+ *
+ * @param lead Seconds before the deadline to wake up at.
+ * @param idle Optional callback run between sleep slices.
+ * @param context Passed to `idle`.
+ * @return InputNow() time of the wake-up.
+ */
+double FramePacer::Wait(double lead, void (*idle)(void*), void* context)
+{
+	const double target = m_Deadline - lead;
+
+	double now = InputNow();
+	while (target - now > SpinWindow)
+	{
+		if (idle) idle(context);
+
+		double sleep = target - InputNow() - SpinWindow;
+		if (idle) sleep = std::min(sleep, IdleSlice);
+		if (sleep > 0)
+			std::this_thread::sleep_for(std::chrono::duration<double>(sleep));
+		now = InputNow();
+	}
+	while (now < target)
+		now = InputNow();
+
+	m_Error.Record(static_cast<uint64_t>((now - target) * 1e6));
+
+	m_Deadline += m_Interval;
+	if (m_Deadline - lead < now) // Fell a whole frame behind: don't try to catch up
+		m_Deadline = now + lead + m_Interval;
+	return now;
+}
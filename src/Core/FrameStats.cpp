@@ -0,0 +1,92 @@
+#include "raylib.h"
+#include "spdlog/spdlog.h"
+#include "Core/FrameStats.h"
+
+namespace
+{
+	struct MetricInfo
+	{
+		const char* name;
+		const char* unit;
+	};
+
+	constexpr MetricInfo MetricInfos[FrameMetricCount] =
+	{
+		{ "frame", "us" },
+		{ "update", "us" },
+		{ "collision", "us" },
+		{ "draw", "us" },
+		{ "entities", "" },
+		{ "bullets", "" },
+		{ "sprites", "" },
+		{ "pushiters", "" },
+	};
+}
+
+/**
+ * @brief Records an update time and, if it is the slowest so far, the load behind it.
+ *
+ * @param micros Update time in microseconds.
+ * @param entities Entities alive during the update.
+ * @param bullets Bullets alive during the update.
+ */
+void FrameStats::RecordUpdate(uint64_t micros, uint64_t entities, uint64_t bullets)
+{
+	Record(FrameMetric::Update, micros);
+	Record(FrameMetric::Entities, entities);
+	Record(FrameMetric::Bullets, bullets);
+
+	if (micros <= m_WorstUpdate.load(std::memory_order_relaxed)) return;
+	m_WorstEntities.store(entities, std::memory_order_relaxed);
+	m_WorstBullets.store(bullets, std::memory_order_relaxed);
+	m_WorstUpdate.store(micros, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Draws one line per metric with its percentiles, on a dark backdrop.
+ *
+ * @param x Left edge in pixels.
+ * @param y Top edge in pixels.
+ */
+void FrameStats::DrawOverlay(int x, int y) const
+{
+	constexpr int FontSize = 20;
+	constexpr int LineHeight = 24;
+
+	DrawRectangle(x - 5, y - 5, 560, LineHeight * (static_cast<int>(FrameMetricCount) + 2) + 5, Fade(BLACK, 0.6f));
+	DrawText("metric       p50     p95     p99     max", x, y, FontSize, WHITE);
+	for (size_t i = 0; i < FrameMetricCount; i++)
+	{
+		const Histogram& metric = m_Metrics[i];
+		y += LineHeight;
+		DrawText(TextFormat("%-10s %7llu %7llu %7llu %7llu %s", MetricInfos[i].name,
+			static_cast<unsigned long long>(metric.Percentile(50)),
+			static_cast<unsigned long long>(metric.Percentile(95)),
+			static_cast<unsigned long long>(metric.Percentile(99)),
+			static_cast<unsigned long long>(metric.Max()), MetricInfos[i].unit), x, y, FontSize, WHITE);
+	}
+	y += LineHeight;
+	DrawText(TextFormat("worst update %lluus at %llu entities, %llu bullets",
+		static_cast<unsigned long long>(m_WorstUpdate.load(std::memory_order_relaxed)),
+		static_cast<unsigned long long>(m_WorstEntities.load(std::memory_order_relaxed)),
+		static_cast<unsigned long long>(m_WorstBullets.load(std::memory_order_relaxed))), x, y, FontSize, YELLOW);
+}
+
+/**
+ * @brief Logs the percentile table and the worst update.
+ */
+void FrameStats::Report() const
+{
+	spdlog::info("Frame stats over {} frames:", Get(FrameMetric::Frame).Count());
+	for (size_t i = 0; i < FrameMetricCount; i++)
+	{
+		const Histogram& metric = m_Metrics[i];
+		spdlog::info("  {:<10} p50 {:>7}{} p95 {:>7}{} p99 {:>7}{} max {:>7}{}", MetricInfos[i].name,
+			metric.Percentile(50), MetricInfos[i].unit, metric.Percentile(95), MetricInfos[i].unit,
+			metric.Percentile(99), MetricInfos[i].unit, metric.Max(), MetricInfos[i].unit);
+	}
+	spdlog::info("  worst update {}us at {} entities, {} bullets",
+		m_WorstUpdate.load(std::memory_order_relaxed),
+		m_WorstEntities.load(std::memory_order_relaxed),
+		m_WorstBullets.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,85 @@
+#include "Core/Histogram.h"
+
+/**
+ * @brief Adds one sample.
+ *
+ * @param value Sample to record; values beyond the top bucket land in it.
+ */
+void Histogram::Record(uint64_t value)
+{
+	m_Buckets[BucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+	m_Count.fetch_add(1, std::memory_order_relaxed);
+
+	uint64_t max = m_Max.load(std::memory_order_relaxed);
+	while (value > max && !m_Max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+}
+
+/**
+ * @brief Forgets every sample. Not atomic as a whole; samples recorded concurrently may survive.
+ */
+void Histogram::Reset()
+{
+	for (std::atomic<uint32_t>& bucket : m_Buckets)
+		bucket.store(0, std::memory_order_relaxed);
+	m_Count.store(0, std::memory_order_relaxed);
+	m_Max.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the value below which the given share of samples fall.
+ *
+ * @param percentile Share in percent, 0 to 100.
+ * @return Representative value of the bucket holding that rank, or 0 if empty.
+ */
+uint64_t Histogram::Percentile(double percentile) const
+{
+	const uint64_t count = Count();
+	if (count == 0) return 0;
+	if (percentile >= 100.0) return Max();
+
+	uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(count) + 0.5);
+	if (rank < 1) rank = 1;
+
+	uint64_t seen = 0;
+	for (size_t i = 0; i < BucketCount; i++)
+	{
+		seen += m_Buckets[i].load(std::memory_order_relaxed);
+		if (seen >= rank)
+		{
+			const uint64_t value = ValueOf(i);
+			const uint64_t max = Max();
+			return value < max ? value : max;
+		}
+	}
+	return Max();
+}
+
+/**
+ * @brief Maps a value to its bucket: the top five significant bits pick it.
+ */
+size_t Histogram::BucketOf(uint64_t value)
+{
+	uint32_t shift = 0;
+	while (value >= 2 * SubCount && shift < MaxShift)
+	{
+		value >>= 1;
+		shift++;
+	}
+	if (value >= 2 * SubCount) // Saturate in the top bucket
+		return BucketCount - 1;
+	if (shift == 0)
+		return static_cast<size_t>(value);
+	return (shift + 1) * SubCount + static_cast<size_t>(value - SubCount);
+}
+
+/**
+ * @brief Returns the midpoint of a bucket's value range.
+ */
+uint64_t Histogram::ValueOf(size_t bucket)
+{
+	if (bucket < 2 * SubCount)
+		return bucket;
+	const uint32_t shift = static_cast<uint32_t>(bucket / SubCount) - 1;
+	const uint64_t low = (SubCount + bucket % SubCount) << shift;
+	return low + ((uint64_t{ 1 } << shift) >> 1);
+}
@@ -0,0 +1,160 @@
+#include "spdlog/spdlog.h"
+#include "Core/PerfCounters.h"
+
+#if defined(GAME_PERF_COUNTERS) && defined(__linux__)
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <iterator>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+	constexpr uint64_t CounterConfigs[PerfCounterCount] =
+	{
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES,
+	};
+
+	/**
+	 * One perf event group per thread; the cycles counter leads it, so all four are
+	 * scheduled together and one read() returns them all.
+	 */
+	struct CounterGroup
+	{
+		int fds[PerfCounterCount];
+		bool open = false;
+
+		CounterGroup()
+		{
+			std::fill(std::begin(fds), std::end(fds), -1);
+			for (size_t i = 0; i < PerfCounterCount; i++)
+			{
+				perf_event_attr attr;
+				std::memset(&attr, 0, sizeof(attr));
+				attr.size = sizeof(attr);
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.config = CounterConfigs[i];
+				attr.read_format = PERF_FORMAT_GROUP;
+				attr.disabled = i == 0; // The leader starts the whole group
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+
+				fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0));
+				if (fds[i] < 0)
+				{
+					static std::atomic<bool> warned{ false };
+					if (!warned.exchange(true))
+						spdlog::warn("perf_event_open failed ({}), hardware counters disabled", std::strerror(errno));
+					return;
+				}
+			}
+			ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+			open = true;
+		}
+
+		~CounterGroup()
+		{
+			for (int fd : fds)
+			{
+				if (fd >= 0) close(fd);
+			}
+		}
+	};
+}
+
+/**
+ * @brief Reads the calling thread's counter group, opening it on first use.
+ *
+ * @param values Receives the counts, indexed by PerfCounter.
+ * @return false if the group could not be opened or read.
+ */
+bool PerfCounters::Read(uint64_t (&values)[PerfCounterCount])
+{
+	thread_local CounterGroup group;
+	if (!group.open) return false;
+
+	struct
+	{
+		uint64_t count;
+		uint64_t values[PerfCounterCount];
+	} data;
+	if (read(group.fds[0], &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+		return false;
+
+	for (size_t i = 0; i < PerfCounterCount; i++)
+		values[i] = data.values[i];
+	return true;
+}
+#else
+/**
+ * @brief Hardware counters are not compiled in.
+ *
+ * @return Always false.
+ */
+bool PerfCounters::Read(uint64_t (&)[PerfCounterCount])
+{
+	return false;
+}
+#endif
+
+namespace
+{
+	constexpr const char* PhaseNames[PerfPhaseCount] = { "update", "collision", "draw" };
+	constexpr const char* CounterNames[PerfCounterCount] = { "cycles", "instructions", "cache-misses", "branch-misses" };
+}
+
+/**
+ * @brief Adds one scope's deltas to the phase's histograms and totals.
+ *
+ * @param phase Phase the deltas belong to.
+ * @param delta Events counted inside the scope.
+ */
+void PerfCounters::Record(PerfPhase phase, const uint64_t (&delta)[PerfCounterCount])
+{
+	const size_t p = static_cast<size_t>(phase);
+	for (size_t i = 0; i < PerfCounterCount; i++)
+	{
+		m_PerFrame[p][i].Record(delta[i]);
+		m_Totals[p][i].fetch_add(delta[i], std::memory_order_relaxed);
+	}
+	m_Frames[p].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Logs, for every phase that recorded anything, the per-frame p50/p99/max of each
+ * counter and the run totals with instructions per cycle and misses per thousand instructions.
+ */
+void PerfCounters::Report() const
+{
+	for (size_t p = 0; p < PerfPhaseCount; p++)
+	{
+		const uint64_t frames = m_Frames[p].load(std::memory_order_relaxed);
+		if (frames == 0) continue;
+
+		uint64_t totals[PerfCounterCount];
+		for (size_t i = 0; i < PerfCounterCount; i++)
+			totals[i] = m_Totals[p][i].load(std::memory_order_relaxed);
+
+		const auto instructions = static_cast<double>(totals[static_cast<size_t>(PerfCounter::Instructions)]);
+		const auto cycles = static_cast<double>(totals[static_cast<size_t>(PerfCounter::Cycles)]);
+		const double kilo = instructions > 0 ? instructions / 1000.0 : 1.0;
+		spdlog::info("Perf counters, {} over {} frames: IPC {:.2f}, cache-misses/kinstr {:.2f}, branch-misses/kinstr {:.2f}",
+			PhaseNames[p], frames, cycles > 0 ? instructions / cycles : 0.0,
+			totals[static_cast<size_t>(PerfCounter::CacheMisses)] / kilo,
+			totals[static_cast<size_t>(PerfCounter::BranchMisses)] / kilo);
+
+		for (size_t i = 0; i < PerfCounterCount; i++)
+		{
+			const Histogram& perFrame = m_PerFrame[p][i];
+			spdlog::info("  {:<14} per frame p50 {:>10} p99 {:>10} max {:>10}, total {}", CounterNames[i],
+				perFrame.Percentile(50), perFrame.Percentile(99), perFrame.Max(), totals[i]);
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/StringInterner.h"
+
+namespace
+{
+	// Function-local statics so interning is safe from other static initialisers
+	struct InternTable
+	{
+		std::mutex mutex;
+		std::unordered_map<std::string, NameId> ids;
+#ifndef NDEBUG
+		std::vector<const std::string*> names; // Keys of `ids`; node-based, so stable
+#endif
+	};
+
+	InternTable& Table()
+	{
+		static InternTable table;
+		return table;
+	}
+}
+
+/**
+ * @brief Interns a string.
+ *
+ * @param name Text to intern.
+ * @return Id shared by every string equal to `name`.
+ */
+NameId StringInterner::Intern(std::string_view name)
+{
+	InternTable& table = Table();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	auto [it, inserted] = table.ids.try_emplace(std::string(name), static_cast<NameId>(table.ids.size()));
+#ifndef NDEBUG
+	if (inserted)
+		table.names.push_back(&it->first);
+#endif
+	return it->second;
+}
+
+/**
+ * @brief Looks up a string without interning it.
+ *
+ * @param name Text to look up.
+ * @return Its id, or InvalidName if it was never interned.
+ */
+NameId StringInterner::Find(std::string_view name)
+{
+	InternTable& table = Table();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	auto it = table.ids.find(std::string(name));
+	return it != table.ids.end() ? it->second : InvalidName;
+}
+
+#ifndef NDEBUG
+/**
+ * @brief Maps an id back to its text. Debug builds only.
+ *
+ * @param id Id returned by Intern.
+ * @return The interned text, or "<invalid>" if the id is unknown.
+ */
+const char* StringInterner::Lookup(NameId id)
+{
+	InternTable& table = Table();
+	std::lock_guard<std::mutex> lock(table.mutex);
+
+	return id < table.names.size() ? table.names[id]->c_str() : "<invalid>";
+}
+#endif
@@ -0,0 +1,142 @@
+#include <algorithm>
+
+#include "Core/TimingWheel.h"
+
+/**
+ * @brief Constructs an empty wheel at tick 0.
+ */
+TimingWheel::TimingWheel()
+{
+	std::fill(std::begin(m_Slots), std::end(m_Slots), Null);
+}
+
+/**
+ * @brief Takes a timer from the pool and links it into the slot for its tick.
+ *
+ * @param tick Tick to fire on; clamped to the next tick if it is not in the future.
+ * @param callback Function to call when the timer fires.
+ * @param userData Context handed to the callback.
+ * @param tag Extra value handed to the callback.
+ * @return Handle of the new timer.
+ */
+TimerId TimingWheel::Schedule(uint64_t tick, Callback callback, void* userData, uint32_t tag)
+{
+	uint32_t id = m_FreeList;
+	if (id != Null)
+		m_FreeList = m_Timers[id].next;
+	else
+	{
+		id = static_cast<uint32_t>(m_Timers.size());
+		m_Timers.emplace_back();
+	}
+
+	Timer& timer = m_Timers[id];
+	timer.tick = std::max(tick, m_Tick + 1);
+	timer.callback = callback;
+	timer.userData = userData;
+	timer.tag = tag;
+	Link(id);
+	m_Pending++;
+	return id;
+}
+
+/**
+ * @brief Unlinks a pending timer and returns it to the pool.
+ *
+ * @param id Handle of the timer; NullTimer is ignored.
+ */
+void TimingWheel::Cancel(TimerId id)
+{
+	if (id == NullTimer) return;
+	Unlink(id);
+	m_Timers[id].next = m_FreeList;
+	m_FreeList = id;
+	m_Pending--;
+}
+
+/**
+ * @brief Steps one tick at a time up to `tick`, cascading and firing as it goes.
+ *
+ * On every tick the coarser wheels that just wrapped are cascaded first (coarsest
+ * first), then every timer in the finest wheel's current slot is fired. A fired timer
+ * is back in the pool before its callback runs.
+ *
+ * @param tick Tick to advance to.
+ */
+void TimingWheel::Advance(uint64_t tick)
+{
+	while (m_Tick < tick)
+	{
+		m_Tick++;
+
+		uint32_t wrapped = 0;
+		while (wrapped + 1 < LevelCount && ((m_Tick >> (SlotBits * (wrapped + 1))) << (SlotBits * (wrapped + 1))) == m_Tick)
+			wrapped++;
+		for (uint32_t level = wrapped; level > 0; level--)
+			Cascade(level);
+
+		uint32_t& head = m_Slots[m_Tick & (SlotCount - 1)];
+		while (head != Null)
+		{
+			const uint32_t id = head;
+			const Callback callback = m_Timers[id].callback;
+			void* userData = m_Timers[id].userData;
+			const uint32_t tag = m_Timers[id].tag;
+			Cancel(id);
+			callback(userData, tag);
+		}
+	}
+}
+
+/**
+ * @brief Links a timer into the finest wheel whose range reaches its tick.
+ */
+void TimingWheel::Link(uint32_t id)
+{
+	Timer& timer = m_Timers[id];
+	const uint64_t delta = timer.tick - m_Tick;
+
+	uint32_t level = 0;
+	while (level + 1 < LevelCount && delta >= (uint64_t{ 1 } << (SlotBits * (level + 1))))
+		level++;
+	const uint32_t index = static_cast<uint32_t>((timer.tick >> (SlotBits * level)) & (SlotCount - 1));
+
+	timer.slot = level * SlotCount + index;
+	timer.prev = Null;
+	timer.next = m_Slots[timer.slot];
+	if (timer.next != Null)
+		m_Timers[timer.next].prev = id;
+	m_Slots[timer.slot] = id;
+}
+
+/**
+ * @brief Removes a timer from its slot's list.
+ */
+void TimingWheel::Unlink(uint32_t id)
+{
+	Timer& timer = m_Timers[id];
+	if (timer.prev != Null)
+		m_Timers[timer.prev].next = timer.next;
+	else
+		m_Slots[timer.slot] = timer.next;
+	if (timer.next != Null)
+		m_Timers[timer.next].prev = timer.prev;
+}
+
+/**
+ * @brief Re-links every timer of a coarse wheel's current slot into finer wheels.
+ *
+ * @param level Wheel that just came round to a new slot.
+ */
+void TimingWheel::Cascade(uint32_t level)
+{
+	const uint32_t index = static_cast<uint32_t>((m_Tick >> (SlotBits * level)) & (SlotCount - 1));
+	uint32_t id = m_Slots[level * SlotCount + index];
+	m_Slots[level * SlotCount + index] = Null;
+	while (id != Null)
+	{
+		const uint32_t next = m_Timers[id].next;
+		Link(id);
+		id = next;
+	}
+}
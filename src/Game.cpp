@@ -1,109 +1,623 @@
-#include <typeinfo>
 #include "Game.h"
-#include "NPCs/Player.h"
+#include "NPCs/EntityTypes.h"
+#include "Core/AllocationCounter.h"
+#include "NPCs/Projectiles/ProjectileStore.h"
+
+namespace
+{
+	uint64_t toMicros(double seconds)
+	{
+		return seconds > 0 ? static_cast<uint64_t>(seconds * 1e6) : 0;
+	}
+
+	/**
+	 * Input for headless runs: strafe two seconds each way, fire every sixth tick and
+	 * attack every quarter second.
+	 */
+	InputFrame scriptedInput(uint64_t tick)
+	{
+		constexpr uint64_t StrafeTicks = 288;
+		constexpr uint64_t FireEvery = 6;
+		constexpr uint64_t AttackEvery = 36;
+
+		InputFrame input;
+		const InputAction direction = (tick / StrafeTicks) % 2 == 0 ? InputAction::MoveRight : InputAction::MoveLeft;
+		input.held[static_cast<size_t>(direction)] = 1.f;
+		input.down[static_cast<size_t>(direction)] = true;
+		if (tick % FireEvery == 0)
+			input.fireCount = 1; // Pressed at the end of the tick
+		input.attackPressed = tick % AttackEvery == 0;
+		return input;
+	}
+}
 
 Game::Game(int height, int width, const char* title)
-	: m_Height(height), m_Width(width), m_Title(title)
+	: m_Broadphase(CreateBroadphase(BroadphaseType::SweepAndPrune)),
+	m_Viewport({ 0, 0, static_cast<float>(width), static_cast<float>(height) }, LodMargin),
+	m_Width(width), m_Height(height), m_Title(title)
 {}
 
 /**
- * @brief Initializes the window and runs the main game loop.
+ * @brief Initializes the window and runs the game until the window is closed.
  *
- * Opens a window using the Game instance's width, height, and title, configures logging
- * and target framerate, creates initial game entities (player and enemy) and stores
- * them in the game's entity list, then enters the main loop. Each frame it calculates
- * delta time, calls update(dt), clears the screen, calls draw() to render entities,
- * and continues until the window is closed. Closes the window on exit.
+ * Opens a window using the Game instance's width, height, and title, configures logging,
+ * loads the level geometry and every entity archetype's textures, spawns the initial game
+ * entities (player and enemy), then starts the simulation thread.
+ *
+ * The calling thread keeps the window and is the only one that touches raylib's input
+ * state: each frame it waits for the next deadline on its FramePacer (polling the
+ * InputSampler between sleep slices and once more on waking, so input events carry
+ * sub-frame timestamps), picks up the most recent RenderSnapshot the simulation published and draws it.
+ * It never touches entity state, so tick N+1 is simulated while tick N is being drawn and
+ * a vsync stall in EndDrawing no longer delays the simulation. Both pacers start from the
+ * same instant, so simulation ticks and presented frames share their deadlines. Both
+ * threads are stopped before the window closes, and the pacing error is logged.
+ * F3 toggles the FrameStats overlay.
  */
 void Game::run()
 {
 	InitWindow(m_Width, m_Height, m_Title);
 	SetTraceLogLevel(TraceLogLevel::LOG_ERROR);
 
-	std::shared_ptr<Player> player = std::make_shared<Player>();
-	std::shared_ptr<Entity> enemy = std::make_shared<Entity>("resources/Player/idle.png", "Enemy", 100.f);
+	load();
+	SetTargetFPS(0); // Paced by m_RenderPacer instead of raylib's sleep
 
-	m_Entities.push_back(player);
-	m_Entities.push_back(enemy);
-	enemy->GetPosition() = { 500, 0 };
-	SetTargetFPS(144);
+	EventLog::Start();
+	m_Recorder.Start(static_cast<uint32_t>(toMicros(TickInterval)));
+	const double start = InputNow();
+	m_LastTickTime = start;
+	m_RenderPacer.Start(start);
+	m_SimPacer.Start(start);
+	m_Running.store(true, std::memory_order_release);
+	m_SimThread = std::thread(&Game::simulate, this);
+	double lastFrame = start;
 	while (!WindowShouldClose())
 	{
-		float dt = GetFrameTime();
-		// Update
-		update(dt);
+		const double frameStart = m_RenderPacer.Wait(0, [](void* input) { static_cast<InputSampler*>(input)->Poll(); }, &m_Input);
+		m_Input.Poll(); // The pacer only polls while it sleeps; a late frame still samples once
+		m_Stats.Record(FrameMetric::Frame, toMicros(frameStart - lastFrame));
+		lastFrame = frameStart;
+
+		// Edge-detect ourselves: input is polled several times per frame
+		const bool statsKey = IsKeyDown(KEY_F3);
+		if (statsKey && !m_StatsKeyHeld)
+			m_ShowStats = !m_ShowStats;
+		m_StatsKeyHeld = statsKey;
+
+		const RenderSnapshot& frame = m_Frames.Acquire();
+
 		// Draw stuff
-		BeginDrawing();
-		ClearBackground(RED);
+		{
+			PerfScope perf(m_Perf, PerfPhase::Draw);
+			BeginDrawing();
+			ClearBackground(RED);
 
-		draw(); // Draw all essentials
-		
-		EndDrawing();
-		
+			draw(frame); // Draw all essentials
+			if (m_ShowStats)
+				m_Stats.DrawOverlay(10, 10);
+			
+			EndDrawing();
+		}
+		m_Stats.Record(FrameMetric::Draw, toMicros(InputNow() - frameStart));
 	}
 	
+	m_Running.store(false, std::memory_order_release);
+	m_SimThread.join();
+	m_Recorder.Stop();
+	EventLog::Stop();
+	logPacing("Render", m_RenderPacer);
+	logPacing("Simulation", m_SimPacer);
+	m_Perf.Report();
+	TextureCache::UnloadAll();
 	CloseWindow();
 }
 
+/**
+ * @brief Runs the simulation without a window for a fixed number of ticks.
+ *
+ * Textures are only decoded for their sizes, the player is driven by a fixed script
+ * (strafing and firing) instead of the keyboard, and ticks run back to back with a
+ * fixed dt, so runs are comparable with each other. The FrameStats report, and the
+ * hardware counter report when built with GAME_PERF_COUNTERS, are logged at exit.
+ *
+ * @param ticks Number of simulation ticks to run.
+ */
+void Game::runHeadless(uint64_t ticks)
+{
+	TextureCache::SetHeadless(true);
+	load();
+	EventLog::Start();
+	m_Recorder.Start(static_cast<uint32_t>(toMicros(TickInterval)));
+
+	RenderSnapshot snapshot;
+	double last = InputNow();
+	while (m_Tick < ticks)
+	{
+		applyInput(scriptedInput(m_Tick));
+		step(static_cast<float>(TickInterval), snapshot);
+
+		const double now = InputNow();
+		m_Stats.Record(FrameMetric::Frame, toMicros(now - last));
+		last = now;
+	}
+
+	m_Recorder.Stop();
+	EventLog::Stop();
+	m_Stats.Report();
+	m_Perf.Report();
+	TextureCache::UnloadAll();
+}
+
+/**
+ * @brief Loads the level and every archetype's textures, then spawns the initial entities.
+ *
+ * GPU resources can only be created on the window thread, so every archetype and the
+ * emitter patterns and item sprites are resolved here, before the simulation starts. The
+ * level's weapons are dropped into the ItemStore, and the enemy fires the "spiral" pattern
+ * if the pattern file has one. Every enemy spawn marker in the level gets a horde of
+ * HordePerSpawn chasers, packed in a small grid centred on it that leaves out slots
+ * overlapping solid tiles. The pushbox solver spreads them out, and CrowdSteering walks
+ * every enemy along the flow field towards the player.
+ */
+void Game::load()
+{
+	m_Level.Load("resources/Levels/arena.txt");
+	EmitterPatterns::Load("resources/Patterns/enemy.txt");
+	ItemStore::LoadTextures();
+	for (const ItemSpawn& item : m_Level.GetItemSpawns())
+		m_Items.Spawn(item.weapon, item.center);
+	m_Flow.Build(m_Level);
+
+	ForEachEntityType([](auto tag) {
+		using T = typename decltype(tag)::type;
+		T::GetArchetype();
+	});
+
+	std::shared_ptr<Player> player = std::make_shared<Player>();
+	std::shared_ptr<Enemy> enemy = std::make_shared<Enemy>();
+
+	enemy->GetPosition() = { 500, 0 };
+	spawn(player);
+	spawn(enemy);
+
+	if (const EmitterPattern* pattern = EmitterPatterns::Find("spiral"))
+		m_Emitters.Attach(*enemy, *pattern, m_Tick);
+
+	// Slots fill a HordeColumns-wide grid centred on the marker, row pairs growing outwards
+	// from it, and skip any slot a solid tile reaches into
+	constexpr int HordeColumns = 8;
+	constexpr int MaxHordeRows = 16;
+	constexpr float HordeSpacing = 24.f;
+	const float sampleStep = m_Level.GetTileSize();
+	const auto blocked = [&](const Rectangle& bounds) {
+		// Sample no further apart than a tile, so no solid tile fits between the samples
+		const int stepsX = std::max(1, static_cast<int>(std::ceil(bounds.width / sampleStep)));
+		const int stepsY = std::max(1, static_cast<int>(std::ceil(bounds.height / sampleStep)));
+		for (int y = 0; y <= stepsY; y++)
+			for (int x = 0; x <= stepsX; x++)
+				if (m_Level.IsSolidAt(bounds.x + bounds.width * x / stepsX, bounds.y + bounds.height * y / stepsY))
+					return true;
+		return false;
+	};
+	for (const Vector2& point : m_Level.GetEnemySpawns())
+	{
+		int spawned = 0;
+		std::shared_ptr<Enemy> chaser; // Kept for the next slot when its slot is blocked
+		for (int slot = 0; slot < HordeColumns * MaxHordeRows && spawned < HordePerSpawn; slot++)
+		{
+			const int row = slot / HordeColumns;
+			const float rowOffset = (row / 2 + 0.5f) * (row % 2 ? 1.f : -1.f); // -0.5, 0.5, -1.5, 1.5...
+			const float columnOffset = slot % HordeColumns - (HordeColumns - 1) * 0.5f;
+
+			if (!chaser)
+				chaser = std::make_shared<Enemy>();
+			Rectangle bounds = chaser->GetBounds();
+			bounds.x = point.x - bounds.width * 0.5f + columnOffset * HordeSpacing;
+			bounds.y = point.y - bounds.height * 0.5f + rowOffset * HordeSpacing;
+			if (blocked(bounds)) continue;
+
+			chaser->GetPosition() = { bounds.x, bounds.y };
+			spawn(std::move(chaser));
+			spawned++;
+		}
+		if (spawned < HordePerSpawn)
+			spdlog::warn("Enemy spawn at ({:.0f}, {:.0f}) only had room for {} of {} chasers", point.x, point.y, spawned, HordePerSpawn);
+	}
+}
+
+/**
+ * @brief Advances the world one tick and records it into a snapshot.
+ *
+ * Times the update and records it in m_Stats with the entity and bullet counts
+ * (every projectile in the ProjectileStore) that ran through it, and counts its hardware events into m_Perf. When headless,
+ * the recording stands in for the draw phase. The tick's TickRecord goes into the
+ * flight recorder, which dumps its ring if the update overran the tick budget or
+ * the tick itself came more than a frame late.
+ *
+ * @param dt Tick length in seconds.
+ * @param snapshot Snapshot to overwrite with the new tick.
+ */
+void Game::step(float dt, RenderSnapshot& snapshot)
+{
+	const uint64_t allocations = AllocationCounter::ThisThread();
+	m_Record.hits = 0;
+
+	const double start = InputNow();
+	{
+		PerfScope perf(m_Perf, PerfPhase::Update);
+		update(dt);
+	}
+	const double updated = InputNow();
+
+	const size_t bullets = ProjectileStore::Size();
+	const uint64_t updateMicros = toMicros(updated - start);
+	m_Stats.RecordUpdate(updateMicros, m_Entities.size(), bullets);
+
+	snapshot.Clear();
+	snapshot.tick = ++m_Tick;
+	if (TextureCache::IsHeadless())
+	{
+		PerfScope perf(m_Perf, PerfPhase::Draw);
+		record(snapshot);
+		m_Stats.Record(FrameMetric::Draw, toMicros(InputNow() - updated));
+	}
+	else
+		record(snapshot);
+	m_Stats.Record(FrameMetric::Sprites, snapshot.sprites.size());
+
+	m_Record.tick = m_Tick;
+	m_Record.dtMicros = static_cast<uint32_t>(toMicros(dt));
+	m_Record.updateMicros = static_cast<uint32_t>(updateMicros);
+	m_Record.allocations = static_cast<uint32_t>(AllocationCounter::ThisThread() - allocations);
+	m_Record.entities = static_cast<uint16_t>(m_Entities.size());
+	m_Record.bullets = static_cast<uint16_t>(std::min<size_t>(bullets, UINT16_MAX));
+	m_Recorder.Push(m_Record);
+
+	if (updated - start > TickInterval || dt > 2 * TickInterval)
+		m_Recorder.Dump(FlightDumpReason::Hitch);
+}
+
+/**
+ * @brief Simulation thread body.
+ *
+ * Runs one tick per deadline of m_SimPacer until run() clears m_Running: latches the
+ * input sampled since the previous tick, steps the world by the measured time into
+ * the triple buffer's back slot and publishes it.
+ *
+ * With late latching on, the tick starts only as long before the deadline as recent
+ * ticks took (plus LatchMargin), so the input it reads is as fresh as possible when the
+ * window thread picks the snapshot up. The estimate jumps up to any slower tick and
+ * decays slowly, so one spike doesn't make the next frames miss. With it off, the
+ * tick starts right after the previous deadline.
+ */
+void Game::simulate()
+{
+	double cost = 0; // Recent worst tick duration, in seconds
+	while (m_Running.load(std::memory_order_acquire))
+	{
+		const double lead = m_LateLatch
+			? std::min(cost + LatchMargin, m_SimPacer.GetInterval())
+			: m_SimPacer.GetInterval();
+		const double wake = m_SimPacer.Wait(lead);
+
+		const double previous = m_LastTickTime;
+		latchInput();
+		step(static_cast<float>(m_LastTickTime - previous), m_Frames.Back());
+		m_Frames.Publish();
+
+		cost = std::max(InputNow() - wake, cost * 0.95);
+	}
+}
+
+/**
+ * @brief Logs the wake-up lateness distribution of a pacer.
+ *
+ * @param name Loop the pacer drives, for the log line.
+ * @param pacer Pacer whose error histogram to summarise.
+ */
+void Game::logPacing(const char* name, const FramePacer& pacer)
+{
+	const Histogram& error = pacer.GetErrorHistogram();
+	spdlog::info("{} pacing error over {} frames: p50 {}us, p99 {}us, max {}us",
+		name, error.Count(), error.Percentile(50), error.Percentile(99), error.Max());
+}
+
 /**
  * @brief Update all game entities for the current frame.
  *
- * Processes each entity in m_Entities: advances simulation by dt, runs collision
- * checks, prunes bullets from any Player that have collided, and finally
- * removes entities flagged as not alive.
+ * Fires the projectile lifetimes due this tick and points the flow field at the first
+ * player; the field is only rebuilt when they change tile. Then runs one hook pass per
+ * concrete entity type (enemies, then players) over the registry's cached lists.
+ *
+ * Players then pick up the items they stand on and start the melee attacks they asked
+ * for, and the emitter volleys due are fired. The enemy crowd is steered and moved in
+ * one SIMD batch. Every other entity's movement is integrated in a single pass over the
+ * dense hot array, and every projectile's in a single pass over the ProjectileStore.
+ * Every animator advances in one pass over the AnimationStore.
+ *
+ * Collisions are resolved last (see collide()), and every melee attack moves on a
+ * frame. Dead entities are removed at the end of the call, after they have been
+ * despawned from the registry and broadphase, and spent projectiles are compacted out
+ * of the store.
  *
  * @param dt Frame delta time in seconds used to advance entity state.
  *
  * Notes:
- * - Null entries in m_Entities are ignored.
- * - Player detection is performed via dynamic_cast; when a Player is found,
- *   its m_Bullets vector is filtered to remove bullets whose CheckCollision
- *   returns true.
- * - Entities that return false from IsAlive() after updates are removed from
- *   m_Entities at the end of the call.
+ * - Every hook is bound to the concrete type at compile time; there are no virtual
+ *   calls or casts with runtime checks in the loop.
+ * - With m_SimLod on, enemies outside the viewport's LOD region only re-steer every
+ *   CrowdSteering::LodInterval ticks, staggered by EntityId so they don't all do so on
+ *   the same tick. Their movement and collisions still run every tick.
+ * - Shots fired during the player pass go straight into the ProjectileStore, so they
+ *   move and collide in the tick they were fired, whoever fired them.
+ * - collide() is timed as FrameMetric::Collision and counted as PerfPhase::Collision.
  */
 void Game::update(float dt)
 {
-	for (const auto& entity : m_Entities)
+	ProjectileStore::Advance(m_Tick);
+	if (const TypedView<Player> players = m_Registry.View<Player>(); !players.empty())
 	{
-		if (!entity) continue;
+		const Rectangle target = (*players.begin())->GetBounds();
+		m_Flow.Update({ target.x + target.width * 0.5f, target.y + target.height * 0.5f });
+	}
 
-		entity->Update(dt);
-		entity->CheckCollision(m_Entities);
+	ForEachEntityType([&](auto tag) {
+		using T = typename decltype(tag)::type;
+		for (T* entity : m_Registry.View<T>())
+			entity->Update(dt);
+	});
 
-		if (auto player = dynamic_cast<Player*>(entity.get()))
+	const TypedView<Player> players = m_Registry.View<Player>();
+	for (Player* player : players)
+	{
+		// Only bare-handed players pick up, so walking over a second weapon doesn't swap it
+		const ItemId item = player->GetWeapon() == FrameData::WeaponId::Fists ? m_Items.FindInRange(player->GetBounds()) : NullItem;
+		if (item != NullItem)
 		{
-			player->m_Bullets.erase(
-				std::remove_if(player->m_Bullets.begin(), player->m_Bullets.end(),
-					[&](auto& bullet) {
-						return bullet->CheckCollision(m_Entities);
-					}),
-				player->m_Bullets.end()
-			);
+			player->SetWeapon(m_Items.GetWeapon(item));
+			m_Items.Remove(item);
+			EventLog::Log<LogLevel::Info>(LogCategory::Combat, "Player picked up weapon {}", static_cast<int>(player->GetWeapon()));
 		}
+		if (player->WantsAttack() && m_Melee.StartAttack(*player, FrameData::GetWeapon(player->GetWeapon()).melee, player->IsFacingLeft()))
+			player->PlayAnimation(AnimState::Attack);
 	}
+	m_Emitters.Update(m_Tick, players.empty() ? nullptr : *players.begin());
+
+	m_Crowd.Update(m_Registry.View<Enemy>(), *m_Broadphase, m_Flow, m_SimLod ? &m_Viewport : nullptr, m_Tick, dt);
+	EntityStore::Integrate(dt);
+	ProjectileStore::Integrate(dt);
+	AnimationStore::Advance();
+
+	const double collisionStart = InputNow();
+	{
+		PerfScope perf(m_Perf, PerfPhase::Collision);
+		collide();
+	}
+	m_Record.collisionMicros = static_cast<uint32_t>(toMicros(InputNow() - collisionStart));
+	m_Stats.Record(FrameMetric::Collision, m_Record.collisionMicros);
+	m_Melee.Advance();
 
 	m_Entities.erase(
 		std::remove_if(m_Entities.begin(), m_Entities.end(),
-			[](const std::shared_ptr<Entity>& e) {
-				return !e->IsAlive();
+			[&](const std::shared_ptr<Entity>& e) {
+				if (e->IsAlive()) return false;
+				onDespawn(*e);
+				return true;
 			}),
 		m_Entities.end()
 	);
+	ProjectileStore::Compact();
 }
 
-
 /**
- * @brief Render all game entities.
+ * @brief Resolves every collision of the tick.
+ *
+ * A per-type pass resolves each entity against the level's static BVH and mirrors it
+ * into the broadphase. The narrowphase then runs only on the candidate pairs the
+ * broadphase reports: each side whose collision mask accepts the other runs its
+ * CheckCollision, and pairs with a side that already died this tick are skipped.
+ * Pairs on the same layer only push: the PushboxSolver then separates every
+ * overlapping pair of fighters, and the bodies it moved are resolved against the level
+ * again and synced back into the broadphase.
  *
- * Iterates over the current entity list and invokes each entity's Draw() method
- * to render it to the active frame. Entities are drawn in the order they
- * appear in m_Entities.
+ * Melee hitboxes then query the same broadphase for the fighters near them (see
+ * MeleeSystem::Resolve).
+ *
+ * Projectiles skip the broadphase: they are tested against the level's tile grid,
+ * binned into the ProjectileStore's own uniform grid, and every entity then tests
+ * only the projectiles in the cells under its bounds.
  */
-void Game::draw()
+void Game::collide()
 {
-	for (const auto& entity : m_Entities)
+	ForEachEntityType([&](auto tag) {
+		using T = typename decltype(tag)::type;
+		for (T* entity : m_Registry.View<T>())
+		{
+			collideStatic(*entity);
+			syncProxy(*entity);
+		}
+	});
+
+	m_Pairs.clear();
+	m_Broadphase->QueryPairs(m_Pairs);
+	for (const BroadphasePair& pair : m_Pairs)
+	{
+		Entity* a = static_cast<Entity*>(pair.userDataA);
+		Entity* b = static_cast<Entity*>(pair.userDataB);
+		if (!a->IsAlive() || !b->IsAlive() || a->GetCollisionLayer() == b->GetCollisionLayer()) continue;
+
+		if (a->CollidesWithLayer(b->GetCollisionLayer()))
+			VisitEntity(*a, [&](auto& first) { m_Record.hits += first.CheckCollision(*b); });
+		if (b->IsAlive() && a->IsAlive() && b->CollidesWithLayer(a->GetCollisionLayer()))
+			VisitEntity(*b, [&](auto& first) { m_Record.hits += first.CheckCollision(*a); });
+	}
+	m_Stats.Record(FrameMetric::PushIterations, m_Pushboxes.Solve(m_Pairs));
+	for (Entity* body : m_Pushboxes.GetBodies())
 	{
-		entity->Draw();
+		// Pushes may have moved the body back into a wall
+		VisitEntity(*body, [&](auto& moved) { collideStatic(moved); });
+		syncProxy(*body);
 	}
-}
\ No newline at end of file
+	m_Record.hits += m_Melee.Resolve(*m_Broadphase);
+
+	ProjectileStore::CollideLevel(m_Level);
+	ProjectileStore::Bin();
+	ForEachEntityType([&](auto tag) {
+		using T = typename decltype(tag)::type;
+		for (T* entity : m_Registry.View<T>())
+			m_Record.hits += ProjectileStore::CollideTarget(*entity);
+	});
+}
+
+/**
+ * @brief Drains the input ring for the tick that is about to be simulated.
+ *
+ * The tick covers the time since the previous call; every player receives the same
+ * InputFrame, with presses and releases placed at their sampled time inside it.
+ */
+void Game::latchInput()
+{
+	const double now = InputNow();
+	const InputFrame input = m_Input.Consume(m_LastTickTime, now);
+	m_LastTickTime = now;
+	applyInput(input);
+}
+
+/**
+ * @brief Hands an input frame to every player and notes it in the tick's flight record.
+ *
+ * @param input Input for the tick that is about to be simulated.
+ */
+void Game::applyInput(const InputFrame& input)
+{
+	for (Player* player : m_Registry.View<Player>())
+		player->SetInput(input);
+
+	m_Record.inputDown = 0;
+	for (size_t i = 0; i < InputActionCount; i++)
+		m_Record.inputDown |= static_cast<uint8_t>(input.down[i] << i);
+	m_Record.fireCount = input.fireCount;
+}
+
+/**
+ * @brief Adds an entity to the world.
+ *
+ * Takes shared ownership in m_Entities and registers the entity with the type
+ * registry and the broadphase.
+ *
+ * @param entity Entity to add; its position should already be set.
+ */
+void Game::spawn(std::shared_ptr<Entity> entity)
+{
+	onSpawn(*entity);
+	m_Entities.push_back(std::move(entity));
+}
+
+/**
+ * @brief Registers a freshly created entity with the registry, broadphase and MeleeSystem.
+ *
+ * @param entity Entity that just came into existence.
+ */
+void Game::onSpawn(Entity& entity)
+{
+	m_Registry.Add(entity);
+	entity.SetProxyId(m_Broadphase->CreateProxy(
+		entity.GetBounds(), entity.GetCollisionLayer(), entity.GetCollisionMask(), &entity));
+	VisitEntity(entity, [&](auto& fighter) { m_Melee.Attach(fighter, std::decay_t<decltype(fighter)>::Fighter); });
+}
+
+/**
+ * @brief Unregisters an entity from the registry and broadphase before it is destroyed.
+ *
+ * Also stops any emitter the entity was firing and drops it from the MeleeSystem.
+ *
+ * @param entity Entity being removed; its registry slot and proxy handle are reset.
+ */
+void Game::onDespawn(Entity& entity)
+{
+	m_Registry.Remove(entity);
+	m_Emitters.Detach(entity);
+	m_Melee.Detach(entity);
+	if (entity.GetProxyId() == NullProxy) return;
+	m_Broadphase->DestroyProxy(entity.GetProxyId());
+	entity.SetProxyId(NullProxy);
+}
+
+/**
+ * @brief Resolves an entity against static level geometry.
+ *
+ * Queries the level BVH with the entity's bounds and lets the entity react to every
+ * collider it overlaps, through its concrete type's OnStaticCollision. Static geometry
+ * never enters the dynamic broadphase.
+ *
+ * @param entity Entity to resolve.
+ */
+template<typename T>
+void Game::collideStatic(T& entity)
+{
+	if (!entity.IsAlive() || !entity.CollidesWithLayer(CollisionLayer::Static) || m_Level.IsEmpty())
+		return;
+
+	m_Level.GetColliders().Query(entity.GetBounds(), [&](const Rectangle& wall) {
+		entity.OnStaticCollision(wall);
+	});
+}
+
+/**
+ * @brief Mirrors an entity's current bounds into the broadphase.
+ *
+ * Only moves the existing proxy so the broadphase can keep its ordering between ticks.
+ *
+ * @param entity Spawned entity to move.
+ */
+void Game::syncProxy(Entity& entity)
+{
+	if (entity.GetProxyId() == NullProxy) return;
+	m_Broadphase->MoveProxy(entity.GetProxyId(), entity.GetBounds());
+}
+
+
+/**
+ * @brief Record the visible game entities into a render snapshot.
+ *
+ * Items on screen are recorded first, found through the ItemStore's grid, so fighters
+ * are drawn over them. Then asks the broadphase for the entities overlapping the viewport, so offscreen entities
+ * cost nothing here or on the render thread. The result is ordered by EntityType and
+ * registry slot, which keeps the per-type draw order, and each entity appends its draw
+ * commands. Projectiles on screen are recorded last, so they are drawn on top of
+ * everything else. Runs on the simulation thread.
+ *
+ * @param out Snapshot of the tick that just finished.
+ */
+void Game::record(RenderSnapshot& out)
+{
+	m_Items.Record(out, m_Viewport.GetView());
+
+	m_Visible.clear();
+	m_Broadphase->QueryRegion(m_Viewport.GetView(), m_Visible);
+	std::sort(m_Visible.begin(), m_Visible.end(), [](void* a, void* b) {
+		const Entity& first = *static_cast<Entity*>(a);
+		const Entity& second = *static_cast<Entity*>(b);
+		if (first.GetType() != second.GetType())
+			return first.GetType() < second.GetType();
+		return first.GetRegistryIndex() < second.GetRegistryIndex();
+	});
+
+	for (void* visible : m_Visible)
+		VisitEntity(*static_cast<Entity*>(visible), [&](auto& entity) { entity.Draw(out); });
+	ProjectileStore::Record(out, m_Viewport.GetView());
+}
+
+/**
+ * @brief Render a published snapshot.
+ *
+ * Draws the level geometry on screen first, then the snapshot's sprites. Runs on the window thread;
+ * the level and viewport are immutable once loaded, so they are safe to read while the simulation runs.
+ *
+ * @param frame Latest snapshot published by the simulation thread.
+ */
+void Game::draw(const RenderSnapshot& frame)
+{
+	m_Level.Draw(m_Viewport.GetView());
+	frame.Draw();
+}
@@ -0,0 +1,104 @@
+#include <algorithm>
+
+#include "raylib.h"
+#include "spdlog/spdlog.h"
+#include "Input/InputSampler.h"
+
+namespace
+{
+	struct KeyBinding
+	{
+		int key;
+		InputAction action;
+	};
+
+	constexpr KeyBinding KeyBindings[] =
+	{
+		{ KEY_A, InputAction::MoveLeft },
+		{ KEY_D, InputAction::MoveRight },
+		{ KEY_W, InputAction::MoveUp },
+		{ KEY_S, InputAction::MoveDown },
+		{ KEY_F, InputAction::Fire },
+		{ KEY_J, InputAction::Attack },
+	};
+}
+
+/**
+ * @brief Pumps OS events and samples the bound actions.
+ *
+ * Reads the state of every bound key (and the left and right mouse buttons for Fire
+ * and Attack), compares it with the previous sample and pushes a timestamped event for
+ * each change. Runs on the window thread, the only one raylib's input state is safe on.
+ */
+void InputSampler::Poll()
+{
+	PollInputEvents();
+
+	bool current[InputActionCount] = {};
+	for (const KeyBinding& binding : KeyBindings)
+		current[static_cast<size_t>(binding.action)] |= IsKeyDown(binding.key);
+	current[static_cast<size_t>(InputAction::Fire)] |= IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+	current[static_cast<size_t>(InputAction::Attack)] |= IsMouseButtonDown(MOUSE_BUTTON_RIGHT);
+
+	const double now = InputNow();
+	for (size_t i = 0; i < InputActionCount; i++)
+	{
+		if (current[i] == m_Sampled[i]) continue;
+		if (!m_Events.TryPush({ now, static_cast<InputAction>(i), current[i] }))
+		{
+			spdlog::warn("Input ring full, dropping event");
+			continue; // Retry on the next sample
+		}
+		m_Sampled[i] = current[i];
+	}
+}
+
+/**
+ * @brief Builds the input frame for one simulation tick.
+ *
+ * Pops every event stamped at or before `tickEnd`, keeping later ones for the next
+ * tick. For each action it accumulates how long it was held within the tick, and for
+ * Fire it records how long before the end of the tick each press happened, so the
+ * simulation can place movement and spawns at their sub-tick time. An Attack press
+ * is only flagged: melee moves start on tick boundaries.
+ *
+ * @param tickStart InputNow() time at which the tick began.
+ * @param tickEnd InputNow() time at which the tick ends.
+ * @return Summary of the tick's input.
+ */
+InputFrame InputSampler::Consume(double tickStart, double tickEnd)
+{
+	InputFrame frame;
+	const double span = tickEnd - tickStart;
+	double heldTime[InputActionCount] = {};
+
+	const InputEvent* event;
+	while (m_Events.Peek(event) && event->time <= tickEnd)
+	{
+		const size_t action = static_cast<size_t>(event->action);
+		const double time = std::clamp(event->time, tickStart, tickEnd);
+		if (event->pressed && !m_Down[action])
+		{
+			m_Down[action] = true;
+			m_DownSince[action] = time;
+			if (event->action == InputAction::Fire && frame.fireCount < InputFrame::MaxPresses)
+				frame.fireOffsets[frame.fireCount++] = static_cast<float>(tickEnd - time);
+			frame.attackPressed |= event->action == InputAction::Attack;
+		}
+		else if (!event->pressed && m_Down[action])
+		{
+			heldTime[action] += time - std::max(m_DownSince[action], tickStart);
+			m_Down[action] = false;
+		}
+		m_Events.Pop();
+	}
+
+	for (size_t i = 0; i < InputActionCount; i++)
+	{
+		if (m_Down[i])
+			heldTime[i] += tickEnd - std::max(m_DownSince[i], tickStart);
+		frame.down[i] = m_Down[i];
+		frame.held[i] = span > 0 ? static_cast<float>(std::clamp(heldTime[i] / span, 0.0, 1.0)) : (m_Down[i] ? 1.f : 0.f);
+	}
+	return frame;
+}
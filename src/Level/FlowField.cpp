@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Level/FlowField.h"
+#include "Level/Level.h"
+
+namespace
+{
+	struct Step
+	{
+		int dx;
+		int dy;
+	};
+
+	constexpr Step Orthogonal[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+	constexpr Step Neighbours[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }, { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+	Vector2 towards(Vector2 from, Vector2 to)
+	{
+		const float dx = to.x - from.x;
+		const float dy = to.y - from.y;
+		const float length = std::sqrt(dx * dx + dy * dy);
+		if (length < 1e-3f) return { 0, 0 };
+		return { dx / length, dy / length };
+	}
+}
+
+/**
+ * @brief Copies the level's tile grid and forgets the current target.
+ *
+ * @param level Loaded level.
+ */
+void FlowField::Build(const Level& level)
+{
+	m_Columns = level.GetColumns();
+	m_Rows = level.GetRows();
+	m_TileSize = level.GetTileSize();
+	m_Origin = level.GetOrigin();
+
+	const size_t cells = static_cast<size_t>(m_Columns) * m_Rows;
+	m_Open.resize(cells);
+	for (int row = 0; row < m_Rows; row++)
+	{
+		for (int column = 0; column < m_Columns; column++)
+			m_Open[static_cast<size_t>(row) * m_Columns + column] = !level.IsSolidTile(column, row);
+	}
+	m_Distance.assign(cells, Unreachable);
+	m_DirX.assign(cells, 0.f);
+	m_DirY.assign(cells, 0.f);
+	m_Frontier.reserve(cells);
+	m_TargetCell = -1;
+}
+
+/**
+ * @brief Moves the target, rebuilding the field if it entered another tile.
+ *
+ * A target off the grid (or on a solid tile) leaves the field pointing at the last
+ * tile it was reachable from; Sample still steers straight at the target itself.
+ *
+ * @param target World-space point to flow towards.
+ * @return true if the field was rebuilt.
+ */
+bool FlowField::Update(Vector2 target)
+{
+	m_Target = target;
+	const int cell = CellAt(target);
+	if (cell < 0 || cell == m_TargetCell || !m_Open[cell]) return false;
+
+	m_TargetCell = cell;
+	Rebuild();
+	return true;
+}
+
+/**
+ * @brief Breadth-first search from the target's tile, then one pass picking each tile's direction.
+ */
+void FlowField::Rebuild()
+{
+	std::fill(m_Distance.begin(), m_Distance.end(), Unreachable);
+	m_Frontier.clear();
+	m_Distance[m_TargetCell] = 0;
+	m_Frontier.push_back(m_TargetCell);
+	for (size_t next = 0; next < m_Frontier.size(); next++) // m_Frontier never reallocates: reserved for every cell
+	{
+		const int cell = m_Frontier[next];
+		const int column = cell % m_Columns, row = cell / m_Columns;
+		for (const Step& step : Orthogonal)
+		{
+			const int x = column + step.dx, y = row + step.dy;
+			if (x < 0 || x >= m_Columns || y < 0 || y >= m_Rows) continue;
+			const int neighbour = y * m_Columns + x;
+			if (!m_Open[neighbour] || m_Distance[neighbour] != Unreachable) continue;
+			m_Distance[neighbour] = static_cast<uint16_t>(m_Distance[cell] + 1);
+			m_Frontier.push_back(neighbour);
+		}
+	}
+
+	const auto open = [&](int x, int y) {
+		return x >= 0 && x < m_Columns && y >= 0 && y < m_Rows && m_Open[y * m_Columns + x];
+	};
+	for (int row = 0; row < m_Rows; row++)
+	{
+		for (int column = 0; column < m_Columns; column++)
+		{
+			const int cell = row * m_Columns + column;
+			m_DirX[cell] = m_DirY[cell] = 0.f;
+			if (m_Distance[cell] == Unreachable || cell == m_TargetCell) continue;
+
+			uint16_t best = m_Distance[cell];
+			Step bestStep = { 0, 0 };
+			for (const Step& step : Neighbours)
+			{
+				const int x = column + step.dx, y = row + step.dy;
+				if (!open(x, y)) continue;
+				if (step.dx != 0 && step.dy != 0 && (!open(column + step.dx, row) || !open(column, row + step.dy)))
+					continue; // Would cut a wall's corner
+				if (m_Distance[y * m_Columns + x] < best)
+				{
+					best = m_Distance[y * m_Columns + x];
+					bestStep = step;
+				}
+			}
+			const Vector2 direction = towards({ 0, 0 }, { static_cast<float>(bestStep.dx), static_cast<float>(bestStep.dy) });
+			m_DirX[cell] = direction.x;
+			m_DirY[cell] = direction.y;
+		}
+	}
+}
+
+/**
+ * @brief Looks up the direction of the tile under a point.
+ *
+ * Points off the grid, on the target's own tile or on tiles the search never reached
+ * (solid, or walled off) steer straight at the target instead.
+ *
+ * @param position World-space point, usually an agent's centre.
+ * @return Unit direction to move in.
+ */
+Vector2 FlowField::Sample(Vector2 position) const
+{
+	const int cell = CellAt(position);
+	if (cell < 0 || m_TargetCell < 0 || cell == m_TargetCell || m_Distance[cell] == Unreachable)
+		return towards(position, m_Target);
+	return { m_DirX[cell], m_DirY[cell] };
+}
+
+/**
+ * @brief Tile index under a point.
+ *
+ * @return Row-major tile index, or -1 off the grid.
+ */
+int FlowField::CellAt(Vector2 position) const
+{
+	const float column = std::floor((position.x - m_Origin.x) / m_TileSize);
+	const float row = std::floor((position.y - m_Origin.y) / m_TileSize);
+	if (!(column >= 0 && column < m_Columns && row >= 0 && row < m_Rows))
+		return -1;
+	return static_cast<int>(row) * m_Columns + static_cast<int>(column);
+}
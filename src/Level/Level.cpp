@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+#include "Level/Level.h"
+
+/**
+ * @brief Loads a level file and bakes its colliders.
+ *
+ * Parses the header (tile size and origin), then the tile grid. Horizontal runs of
+ * solid tiles are merged into one rectangle, and a run with the same extent on the
+ * next row extends the rectangle downwards, so a solid block of any size becomes a
+ * single collider. The resulting rectangles are built into the BVH, and the raw tile
+ * grid is kept for point queries, and weapon and enemy glyphs are collected as spawns.
+ *
+ * @param path Path to the level file.
+ * @return true if the level was loaded; false (and the old level kept) on error.
+ */
+bool Level::Load(const char* path)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		spdlog::error("Couldn't open level '{}'", path);
+		return false;
+	}
+
+	float tileSize = 60.f;
+	Vector2 origin = { 0, 0 };
+	std::vector<Rectangle> colliders;
+	std::map<std::pair<int, int>, size_t> openRuns; // [start, end) column run -> collider growing downwards
+	std::vector<std::string> rows; // Map lines, for the tile grid
+	std::vector<ItemSpawn> items;
+	std::vector<Vector2> enemies;
+
+	bool inMap = false;
+	int row = 0;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		if (!inMap)
+		{
+			if (line.empty() || line.rfind("//", 0) == 0)
+				continue;
+
+			std::istringstream header(line);
+			std::string key;
+			header >> key;
+			if (key == "tile")
+				header >> tileSize;
+			else if (key == "origin")
+				header >> origin.x >> origin.y;
+			else if (key == "map")
+				inMap = true;
+			else
+			{
+				spdlog::error("Level '{}': unknown key '{}'", path, key);
+				return false;
+			}
+
+			if (header.fail() || tileSize <= 0)
+			{
+				spdlog::error("Level '{}': bad value for '{}'", path, key);
+				return false;
+			}
+			continue;
+		}
+
+		rows.push_back(line);
+		std::map<std::pair<int, int>, size_t> rowRuns;
+		const int width = static_cast<int>(line.size());
+		for (int column = 0; column < width;)
+		{
+			if (line[column] != '#')
+			{
+				const Vector2 center = { origin.x + (column + 0.5f) * tileSize, origin.y + (row + 0.5f) * tileSize };
+				if (line[column] == 'k' || line[column] == 'b')
+					items.push_back({ line[column] == 'k' ? FrameData::WeaponId::Knife : FrameData::WeaponId::BrokenBottle, center });
+				else if (line[column] == 'e')
+					enemies.push_back(center);
+				column++;
+				continue;
+			}
+
+			const int start = column;
+			while (column < width && line[column] == '#')
+				column++;
+
+			const auto run = std::make_pair(start, column);
+			auto open = openRuns.find(run);
+			if (open != openRuns.end())
+			{
+				colliders[open->second].height += tileSize;
+				rowRuns[run] = open->second;
+			}
+			else
+			{
+				colliders.push_back({
+					origin.x + start * tileSize,
+					origin.y + row * tileSize,
+					(column - start) * tileSize,
+					tileSize
+				});
+				rowRuns[run] = colliders.size() - 1;
+			}
+		}
+		openRuns = std::move(rowRuns);
+		row++;
+	}
+
+	if (!inMap)
+	{
+		spdlog::error("Level '{}' has no map section", path);
+		return false;
+	}
+
+	size_t columns = 0;
+	for (const std::string& mapRow : rows)
+		columns = std::max(columns, mapRow.size());
+	m_Solid.assign(columns * rows.size(), 0);
+	for (size_t y = 0; y < rows.size(); y++)
+	{
+		for (size_t x = 0; x < rows[y].size(); x++)
+			m_Solid[y * columns + x] = rows[y][x] == '#';
+	}
+	m_Columns = static_cast<int>(columns);
+	m_Rows = static_cast<int>(rows.size());
+	m_TileSize = tileSize;
+	m_Origin = origin;
+	m_ItemSpawns = std::move(items);
+	m_EnemySpawns = std::move(enemies);
+
+	m_Colliders.Build(std::move(colliders));
+	spdlog::info("Loaded level '{}': {} colliders, {} BVH nodes, {} items, {} enemy spawns",
+		path, m_Colliders.GetColliders().size(), m_Colliders.GetNodeCount(), m_ItemSpawns.size(), m_EnemySpawns.size());
+	return true;
+}
+
+/**
+ * @brief Draws every visible collider as a filled rectangle.
+ *
+ * @param view World-space rectangle on screen.
+ */
+void Level::Draw(const Rectangle& view) const
+{
+	m_Colliders.Query(view, [](const Rectangle& collider) {
+		DrawRectangleRec(collider, DARKGRAY);
+	});
+}
+
+/**
+ * @brief Tests whether a world-space point lies inside a solid tile.
+ *
+ * One grid lookup, for callers with too many points to go through the BVH (projectiles).
+ * Points outside the map, and NaN coordinates, are not solid.
+ *
+ * @param x World-space x coordinate.
+ * @param y World-space y coordinate.
+ * @return true if the tile under the point is solid.
+ */
+bool Level::IsSolidAt(float x, float y) const
+{
+	const float column = std::floor((x - m_Origin.x) / m_TileSize);
+	const float row = std::floor((y - m_Origin.y) / m_TileSize);
+	if (!(column >= 0 && column < m_Columns && row >= 0 && row < m_Rows))
+		return false;
+	return m_Solid[static_cast<size_t>(row) * m_Columns + static_cast<size_t>(column)] != 0;
+}
@@ -0,0 +1,178 @@
+#include <cmath>
+
+#include "NPCs/CrowdSteering.h"
+#include "NPCs/Enemy.h"
+#include "Physics/Broadphase.h"
+#include "Physics/CollisionLayer.h"
+#include "Level/FlowField.h"
+#include "Render/Viewport.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CROWD_SIMD 1
+#endif
+
+/**
+ * @brief Computes every enemy's velocity for the tick and moves it.
+ *
+ * Gather pass, per enemy:
+ * - seek is the flow field's unit direction under its centre;
+ * - up to MaxNeighbors other enemies within NeighborRadius each add a push away from
+ *   them, growing linearly from zero at the radius to one walk speed when touching;
+ * - alignment is the neighbours' average velocity in walk speeds.
+ *
+ * With `lod` set, an enemy far outside its view only runs the gather pass on its
+ * `(tick + id) % LodInterval` slot. In between it keeps its velocity and only moves.
+ *
+ * Blend pass, four enemies at a time: the wanted velocity is the weighted sum of the
+ * terms scaled to walk speed and clamped to it, the velocity moves towards it by
+ * Responsiveness * dt of the gap (times LodInterval on a far enemy's slot), and the
+ * position moves by the new velocity * dt.
+ *
+ * Write-back pass: positions and velocities go back into the hot records.
+ *
+ * @param agents Every enemy.
+ * @param broadphase Broadphase holding every enemy's proxy.
+ * @param flow Field towards the chase target.
+ * @param lod Viewport deciding which enemies are far, or nullptr to steer all every tick.
+ * @param tick Current tick, to spread far enemies' slots.
+ * @param dt Tick length in seconds.
+ */
+void CrowdSteering::Update(TypedView<Enemy> agents, Broadphase& broadphase, const FlowField& flow,
+	const Viewport* lod, uint64_t tick, float dt)
+{
+	const size_t count = agents.size();
+	const size_t padded = (count + 3) & ~size_t{ 3 };
+	for (std::vector<float>* column : { &m_PX, &m_PY, &m_VX, &m_VY, &m_SeekX, &m_SeekY, &m_SeparationX, &m_SeparationY, &m_AlignX, &m_AlignY, &m_Blend })
+		column->assign(padded, 0.f);
+
+	const float maxSpeed = FrameData::GetFighter(Enemy::Fighter).walkSpeed;
+	const float invSpeed = maxSpeed > 0 ? 1.f / maxSpeed : 0.f;
+	const float blend = std::fmin(1.f, Responsiveness * dt);
+	const float farBlend = std::fmin(1.f, Responsiveness * dt * LodInterval);
+	constexpr float Radius = NeighborRadius;
+	size_t i = 0;
+	for (Enemy* agent : agents)
+	{
+		const EntityHot& hot = agent->Hot();
+		m_PX[i] = hot.position.x;
+		m_PY[i] = hot.position.y;
+		m_VX[i] = hot.velocity.x;
+		m_VY[i] = hot.velocity.y;
+
+		// Off its slot, a far agent's terms stay zero and a zero blend keeps its velocity
+		m_Blend[i] = blend;
+		if (lod && lod->IsFar(agent->GetBounds()))
+		{
+			if ((tick + agent->GetId()) % LodInterval != 0)
+			{
+				i++;
+				continue;
+			}
+			m_Blend[i] = farBlend;
+		}
+
+		const Vector2 center = { hot.position.x + hot.halfExtents.x, hot.position.y + hot.halfExtents.y };
+		const Vector2 seek = flow.Sample(center);
+		m_SeekX[i] = seek.x;
+		m_SeekY[i] = seek.y;
+
+		// One extra result, since the agent finds itself
+		m_Neighbors.clear();
+		broadphase.QueryNearby({ center.x - Radius, center.y - Radius, 2 * Radius, 2 * Radius }, CollisionLayer::Enemy, MaxNeighbors + 1, m_Neighbors);
+		float separationX = 0, separationY = 0, alignX = 0, alignY = 0;
+		int neighbors = 0;
+		for (void* candidate : m_Neighbors)
+		{
+			const Entity* other = static_cast<const Entity*>(candidate);
+			if (other == agent || !other->IsAlive()) continue;
+
+			const EntityHot& them = other->Hot();
+			const float dx = center.x - (them.position.x + them.halfExtents.x);
+			const float dy = center.y - (them.position.y + them.halfExtents.y);
+			const float distance = std::sqrt(dx * dx + dy * dy);
+			if (distance >= Radius) continue;
+
+			// Exactly stacked agents are left to the pushbox solver
+			if (distance > 1e-3f)
+			{
+				const float strength = (1.f - distance / Radius) / distance;
+				separationX += dx * strength;
+				separationY += dy * strength;
+			}
+			alignX += them.velocity.x;
+			alignY += them.velocity.y;
+			neighbors++;
+		}
+
+		m_SeparationX[i] = separationX;
+		m_SeparationY[i] = separationY;
+		if (neighbors > 0)
+		{
+			m_AlignX[i] = alignX * invSpeed / neighbors;
+			m_AlignY[i] = alignY * invSpeed / neighbors;
+		}
+		i++;
+	}
+
+	i = 0;
+#ifdef CROWD_SIMD
+	const __m128 seekWeight = _mm_set1_ps(SeekWeight);
+	const __m128 separationWeight = _mm_set1_ps(SeparationWeight);
+	const __m128 alignWeight = _mm_set1_ps(AlignmentWeight);
+	const __m128 speed = _mm_set1_ps(maxSpeed);
+	const __m128 one = _mm_set1_ps(1.f);
+	const __m128 tiny = _mm_set1_ps(1e-6f);
+	const __m128 step = _mm_set1_ps(dt);
+	for (; i < padded; i += 4)
+	{
+		__m128 wantX = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_loadu_ps(m_SeekX.data() + i), seekWeight),
+			_mm_mul_ps(_mm_loadu_ps(m_SeparationX.data() + i), separationWeight)),
+			_mm_mul_ps(_mm_loadu_ps(m_AlignX.data() + i), alignWeight));
+		__m128 wantY = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_loadu_ps(m_SeekY.data() + i), seekWeight),
+			_mm_mul_ps(_mm_loadu_ps(m_SeparationY.data() + i), separationWeight)),
+			_mm_mul_ps(_mm_loadu_ps(m_AlignY.data() + i), alignWeight));
+
+		// In walk speeds here, so clamp the length to one before scaling
+		const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(wantX, wantX), _mm_mul_ps(wantY, wantY)));
+		const __m128 scale = _mm_mul_ps(speed, _mm_min_ps(one, _mm_div_ps(one, _mm_max_ps(length, tiny))));
+		wantX = _mm_mul_ps(wantX, scale);
+		wantY = _mm_mul_ps(wantY, scale);
+
+		const __m128 blend4 = _mm_loadu_ps(m_Blend.data() + i);
+		__m128 vx = _mm_loadu_ps(m_VX.data() + i);
+		__m128 vy = _mm_loadu_ps(m_VY.data() + i);
+		vx = _mm_add_ps(vx, _mm_mul_ps(_mm_sub_ps(wantX, vx), blend4));
+		vy = _mm_add_ps(vy, _mm_mul_ps(_mm_sub_ps(wantY, vy), blend4));
+		_mm_storeu_ps(m_VX.data() + i, vx);
+		_mm_storeu_ps(m_VY.data() + i, vy);
+		_mm_storeu_ps(m_PX.data() + i, _mm_add_ps(_mm_loadu_ps(m_PX.data() + i), _mm_mul_ps(vx, step)));
+		_mm_storeu_ps(m_PY.data() + i, _mm_add_ps(_mm_loadu_ps(m_PY.data() + i), _mm_mul_ps(vy, step)));
+	}
+#else
+	for (; i < padded; i++)
+	{
+		float wantX = m_SeekX[i] * SeekWeight + m_SeparationX[i] * SeparationWeight + m_AlignX[i] * AlignmentWeight;
+		float wantY = m_SeekY[i] * SeekWeight + m_SeparationY[i] * SeparationWeight + m_AlignY[i] * AlignmentWeight;
+		const float length = std::sqrt(wantX * wantX + wantY * wantY);
+		const float scale = maxSpeed * std::fmin(1.f, 1.f / std::fmax(length, 1e-6f));
+		wantX *= scale;
+		wantY *= scale;
+		m_VX[i] += (wantX - m_VX[i]) * m_Blend[i];
+		m_VY[i] += (wantY - m_VY[i]) * m_Blend[i];
+		m_PX[i] += m_VX[i] * dt;
+		m_PY[i] += m_VY[i] * dt;
+	}
+#endif
+
+	i = 0;
+	for (Enemy* agent : agents)
+	{
+		EntityHot& hot = agent->Hot();
+		hot.position = { m_PX[i], m_PY[i] };
+		hot.velocity = { m_VX[i], m_VY[i] };
+		i++;
+	}
+}
@@ -0,0 +1,31 @@
+#include "NPCs/Enemy.h"
+
+/**
+ * @brief Constructs an Enemy.
+ *
+ * Uses the Enemy archetype (idle player sprite, interned name "Enemy"),
+ * the hit points of its FrameData fighter entry and CollisionLayer::Enemy. Flagged
+ * Steered: CrowdSteering moves it, not EntityStore::Integrate.
+ */
+Enemy::Enemy()
+	: EntityBase(FrameData::GetFighter(Fighter).hp, CollisionLayer::Enemy)
+{
+	Hot().flags |= EntityFlags::Steered;
+}
+
+/**
+ * @brief Resolves the Enemy archetype on first use.
+ *
+ * Every state plays the player's idle sprite until enemies get art of their own.
+ *
+ * @return The interned name "Enemy" and its animation clips.
+ */
+const Archetype& Enemy::GetArchetype()
+{
+	static const Archetype archetype = [] {
+		const ClipId idle = AnimationLibrary::AddStrip("resources/Player/idle.png", 1, 1, true);
+		return Archetype{ StringInterner::Intern("Enemy"), { { idle, idle, idle, idle, idle } } };
+	}();
+	return archetype;
+}
+
@@ -1,21 +1,53 @@
+#include <cmath>
+
 #include "NPCs/Entity.h"
 
+namespace
+{
+	EntityId s_NextId = NullEntity + 1;
+}
+
 /**
- * @brief Constructs an Entity with a texture, name, and initial health.
+ * @brief Constructs an Entity with its animations, name, and initial health.
  *
- * Initializes the entity's name and hit points, and loads the texture from the provided path
- * to initialize the entity's texture resource.
+ * Allocates the entity's hot record in the EntityStore and fills it with the hit
+ * points, collision filter and half-extents taken from the size of the first idle
+ * frame, and an animator in the AnimationStore playing the idle clip. The interned
+ * name and a fresh EntityId stay on the entity as cold data.
  *
- * @param texturePath File path to the texture image used by the entity.
- * @param name Human-readable name for the entity.
+ * @param archetype Interned name and animation clips of the concrete class.
  * @param hp Initial health (hit points) for the entity.
+ * @param collisionLayer CollisionLayer bit for the entity; the mask is initialised from
+ *                       CollisionLayer::DefaultMask and can be narrowed with SetCollisionMask.
+ * @param type Type tag of the concrete class, used by EntityRegistry queries.
  */
 Entity::Entity(
-	const char* texturePath,
-	const std::string name,
-	float hp
-) : m_Name(name), m_Hp(hp), m_Texture(LoadTexture(texturePath))
-{}
+	const Archetype& archetype,
+	float hp,
+	uint32_t collisionLayer,
+	EntityType type
+) : m_NameId(archetype.name), m_Type(type),
+	m_Id(s_NextId++), m_HotIndex(EntityStore::Allocate(this)),
+	m_AnimIndex(AnimationStore::Allocate(this, archetype.animations))
+{
+	const Rectangle& frame = AnimationStore::Get(m_AnimIndex).GetSource();
+
+	EntityHot& hot = Hot();
+	hot.halfExtents = { frame.width * 0.5f, frame.height * 0.5f };
+	hot.hp = hp;
+	hot.flags = EntityFlags::Alive;
+	hot.layer = static_cast<uint8_t>(collisionLayer);
+	hot.mask = static_cast<uint8_t>(CollisionLayer::DefaultMask(collisionLayer));
+}
+
+/**
+ * @brief Returns the entity's hot record and animator to their stores.
+ */
+Entity::~Entity()
+{
+	EntityStore::Release(m_HotIndex);
+	AnimationStore::Release(m_AnimIndex);
+}
 
 /**
  * @brief Applies damage to the entity's health.
@@ -32,69 +64,93 @@ void Entity::TakeDamage(float damage)
 	if (damage < 0)
 		damage = damage * -1;
 
-	m_Hp -= damage;
-	if (m_Hp <= 0)
+	EntityHot& hot = Hot();
+	hot.hp -= damage;
+	if (hot.hp <= 0)
 	{
-		m_IsAlive = false;
+		hot.flags &= ~EntityFlags::Alive;
 	}
 }
 
 /**
- * @brief Draws the entity's texture at its current position.
- *
- * If the entity instance is valid, renders the entity's texture at m_Position using a WHITE tint.
- */
-void Entity::CommonDraw()
-{
-	if (this != nullptr)
-		DrawTexture(m_Texture, m_Position.x, m_Position.y, WHITE);
-}
-
-/**
- * @brief Per-frame update hook for the entity.
+ * @brief Records the entity's current animation frame over its bounds.
  *
- * This implementation is a no-op. Derived classes should override this method
- * to update entity state using the elapsed time since the last frame.
+ * The frame is stretched to the hot half-extents when drawn, so entities that are
+ * smaller than their sprite can share the same clips.
  *
- * @param dt Time elapsed since the last frame, in seconds.
+ * @param out Snapshot the sprite is appended to.
  */
-void Entity::CommonUpdate(float dt)
+void Entity::CommonDraw(RenderSnapshot& out) const
 {
-	
+	const Animator& animator = AnimationStore::Get(m_AnimIndex);
+	out.Sprite(GetBounds(), animator.GetTexture(), animator.GetSource());
 }
 
 /**
  * @brief Tests axis-aligned bounding-box collision between this entity and another.
  *
- * Determines whether this entity's rectangular bounds (position + its texture width/height)
- * overlap the other's rectangular bounds. The function returns false if `other` refers to
- * the same object as this entity or if the boxes are separated on any axis; it returns true
- * when an overlap (collision) is detected.
+ * Determines whether this entity's rectangular bounds (position + twice its half-extents)
+ * overlap the other's rectangular bounds, reading only the two hot records. The function
+ * returns false if `other` is on a layer outside this entity's collision mask (checked
+ * first, before any geometry is read), if it
+ * refers to the same object as this entity or if the boxes are separated on any axis; it
+ * returns true when an overlap (collision) is detected.
  *
- * @param other Shared pointer to the other Entity to test for collision; must be non-null.
+ * @param other The other Entity to test for collision.
  * @return true if the entities' bounding boxes overlap (collision detected).
- * @return false if `other` is the same object as this entity or if no overlap is found.
+ * @return false if `other` is filtered out by the collision mask, is the same object as this
+ *         entity, or if no overlap is found.
  *
- * Side effects: logs "Hit!" via spdlog when a collision is detected.
+ * Side effects: queues a Collision event on the EventLog when a collision is detected;
+ * formatting and output happen on the log thread.
  */
-bool Entity::CheckCollision(std::shared_ptr<Entity> other)
+bool Entity::CheckCollision(Entity& other)
 {
-	if (this == other.get()) return false; // It can't collide with itself
-	Vector2 otherPosition = other->GetPosition();
-	Texture2D otherTexture = other->GetTexture();
+	const EntityHot& self = Hot();
+	const EntityHot& target = other.Hot();
+	if (!(self.mask & target.layer)) return false; // Layer not in our mask
+	if (this == &other) return false; // It can't collide with itself
 
-	float height = otherTexture.height;
-	float width = otherTexture.width;
+	const Rectangle a = self.Bounds();
+	const Rectangle b = target.Bounds();
 
-	if (otherPosition.x + width < m_Position.x)
+	if (b.x + b.width < a.x)
 		return false;
-	if (m_Position.x + m_Texture.width < otherPosition.x)
+	if (a.x + a.width < b.x)
 		return false;
-	if (otherPosition.y + height < m_Position.y)
+	if (b.y + b.height < a.y)
 		return false;
-	if (m_Position.y + m_Texture.height < otherPosition.y)
+	if (a.y + a.height < b.y)
 		return false;
 
-	spdlog::info("Hit!");
+	EventLog::Log<LogLevel::Info>(LogCategory::Collision, "Hit at ({:.0f}, {:.0f})", a.x, a.y);
 	return true;
+}
+
+/**
+ * @brief Pushes the entity out of a static collider.
+ *
+ * Computes the penetration depth on each side of the wall and moves the entity by the
+ * smallest one, so it slides along walls and floors instead of snapping to a corner.
+ * Does nothing if the boxes only touch.
+ *
+ * @param wall World-space rectangle of the static collider.
+ */
+void Entity::OnStaticCollision(const Rectangle& wall)
+{
+	const Rectangle bounds = GetBounds();
+	const float pushLeft = bounds.x + bounds.width - wall.x;
+	const float pushRight = wall.x + wall.width - bounds.x;
+	const float pushUp = bounds.y + bounds.height - wall.y;
+	const float pushDown = wall.y + wall.height - bounds.y;
+	if (pushLeft <= 0 || pushRight <= 0 || pushUp <= 0 || pushDown <= 0)
+		return;
+
+	const float pushX = pushLeft < pushRight ? -pushLeft : pushRight;
+	const float pushY = pushUp < pushDown ? -pushUp : pushDown;
+	Vector2& position = Hot().position;
+	if (std::abs(pushX) < std::abs(pushY))
+		position.x += pushX;
+	else
+		position.y += pushY;
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "NPCs/EntityHot.h"
+#include "NPCs/Entity.h"
+
+std::vector<EntityHot> EntityStore::s_Hot;
+std::vector<Entity*> EntityStore::s_Owners;
+
+/**
+ * @brief Reserves a zeroed hot record for a new entity.
+ *
+ * @param owner Entity that will own the record.
+ * @return Index of the record; the owner must hand it back through Release.
+ */
+uint32_t EntityStore::Allocate(Entity* owner)
+{
+	s_Hot.push_back({});
+	s_Owners.push_back(owner);
+	return static_cast<uint32_t>(s_Hot.size() - 1);
+}
+
+/**
+ * @brief Frees a hot record.
+ *
+ * The last record is moved into the freed slot and its owner's index is updated.
+ *
+ * @param index Index previously returned by Allocate.
+ */
+void EntityStore::Release(uint32_t index)
+{
+	const uint32_t last = static_cast<uint32_t>(s_Hot.size() - 1);
+	if (index != last)
+	{
+		s_Hot[index] = s_Hot[last];
+		s_Owners[index] = s_Owners[last];
+		s_Owners[index]->m_HotIndex = index;
+	}
+	s_Hot.pop_back();
+	s_Owners.pop_back();
+}
+
+/**
+ * @brief Advances every live entity's position by its velocity.
+ *
+ * The standard movement step shared by all entities but the Steered ones, which
+ * CrowdSteering moves in its own SIMD pass. It only reads and writes the dense hot
+ * array, so it streams through memory without touching any Entity object.
+ *
+ * @param dt Time elapsed since the last tick, in seconds.
+ */
+void EntityStore::Integrate(float dt)
+{
+	for (EntityHot& hot : s_Hot)
+	{
+		if ((hot.flags & (EntityFlags::Alive | EntityFlags::Steered)) != EntityFlags::Alive) continue;
+		hot.position.x += hot.velocity.x * dt;
+		hot.position.y += hot.velocity.y * dt;
+	}
+}
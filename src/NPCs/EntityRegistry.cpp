@@ -0,0 +1,39 @@
+#include "NPCs/EntityRegistry.h"
+
+/**
+ * @brief Appends an entity to the list of its type.
+ *
+ * The entity remembers its slot so it can be removed in constant time. Adding an
+ * entity that is already registered does nothing.
+ *
+ * @param entity Entity that just spawned.
+ */
+void EntityRegistry::Add(Entity& entity)
+{
+	if (entity.GetRegistryIndex() != UnregisteredIndex) return;
+
+	std::vector<Entity*>& list = m_Lists[static_cast<size_t>(entity.GetType())];
+	entity.SetRegistryIndex(static_cast<uint32_t>(list.size()));
+	list.push_back(&entity);
+}
+
+/**
+ * @brief Removes an entity from the list of its type.
+ *
+ * The last entity of the list is moved into the freed slot and its index patched.
+ * Removing an unregistered entity does nothing.
+ *
+ * @param entity Entity that is despawning.
+ */
+void EntityRegistry::Remove(Entity& entity)
+{
+	const uint32_t index = entity.GetRegistryIndex();
+	if (index == UnregisteredIndex) return;
+
+	std::vector<Entity*>& list = m_Lists[static_cast<size_t>(entity.GetType())];
+	Entity* last = list.back();
+	list[index] = last;
+	last->SetRegistryIndex(index);
+	list.pop_back();
+	entity.SetRegistryIndex(UnregisteredIndex);
+}
@@ -1,108 +1,172 @@
+#include <algorithm>
+
 #include "NPCs/Player.h"
-#include "NPCs/Projectiles/Bullet.h"
-static bool aiming_left = false;
+#include "NPCs/Projectiles/ProjectileStore.h"
 
 /**
  * @brief Constructs a Player with the default visual and movement settings.
  *
- * Initializes a Player entity using the idle texture ("resources/Player/idle.png"),
- * sets its name to "Player", and configures its movement speed to 300.f.
+ * Initializes a Player entity from the Player archetype (animation clips, interned name
+ * "Player") with the hit points of its FrameData fighter entry. The player lives on
+ * CollisionLayer::Player, so its own projectiles never test against it.
  */
 Player::Player()
-	: Entity("resources/Player/idle.png", "Player", 300.f)
+	: EntityBase(Stats.hp, CollisionLayer::Player)
 { }
 
 /**
- * @brief Renders all bullets owned by the player.
+ * @brief Resolves the Player archetype on first use.
+ *
+ * Cuts the directional clips out of their sheets and loads the shot sprite, so
+ * resolving the archetype on the window thread is enough for every texture the player
+ * can switch to. The sheets hold one frame each for now. There is no attack sheet yet,
+ * so the attack one-shot holds the idle pose for AttackTicks.
+ *
+ * @return The interned name "Player" and its animation clips.
+ */
+const Archetype& Player::GetArchetype()
+{
+	static const Archetype archetype = [] {
+		GetShotTexture();
+		const AnimationSet animations{ {
+			AnimationLibrary::AddStrip(IDLE, 1, 1, true),
+			AnimationLibrary::AddStrip(LEFT, 1, 1, true),
+			AnimationLibrary::AddStrip(RIGHT, 1, 1, true),
+			AnimationLibrary::AddStrip(UP, 1, 1, true),
+			AnimationLibrary::AddStrip(IDLE, 1, AttackTicks, false),
+		} };
+		return Archetype{ StringInterner::Intern("Player"), animations };
+	}();
+	return archetype;
+}
+
+/**
+ * @brief Loads the sprite of the player's shots on first use.
  *
- * Calls each bullet's Draw() method so the player's active projectiles are rendered
- * to the current render target.
+ * @return Texture handle of the shot sprite.
  */
-void Player::OnDraw()
+TextureId Player::GetShotTexture()
 {
-	for (auto bullet : m_Bullets)
-		bullet->Draw();
+	static const TextureId shot = TextureCache::Load(SHOT);
+	return shot;
 }
 
 /**
- * @brief Process input, update player movement, handle firing, and manage bullets for this frame.
+ * @brief Stores the input frame the next OnUpdate will act on.
  *
- * This updates the player's position and texture based on keyboard input (W/A/S/D),
- * sets the shooting direction flag, spawns bullets when firing input is received,
- * removes out-of-bounds bullets, and updates all active bullets.
+ * @param input Input sampled for the current tick.
+ */
+void Player::SetInput(const InputFrame& input)
+{
+	m_Input = input;
+}
+
+/**
+ * @brief The direction the player last aimed in, which melee attacks face too.
+ *
+ * @return true if facing left.
+ */
+bool Player::IsFacingLeft() const
+{
+	return m_FacingLeft;
+}
+
+/**
+ * @brief Process input, update player movement and handle firing for this frame.
+ *
+ * This sets the player's velocity and animation state from the tick's InputFrame (W/A/S/D),
+ * sets the shooting direction flag, notes an Attack press and fires a shot for every Fire
+ * press in the tick.
+ * The position itself is advanced by EntityStore::Integrate.
  *
  * Movement:
- * - A/D move left/right and set the shooting direction (aiming_left).
+ * - A/D move left/right and set the shooting direction (m_FacingLeft).
  * - W/S take priority over A/D and force the shooting direction to right.
+ * - Each direction contributes in proportion to the fraction of the tick it was held,
+ *   so a key pressed or released mid-tick moves the player for exactly that long.
+ * - The animation state follows the same priority (up, then left/right, else idle);
+ *   changing it only switches the clip index.
  *
  * Firing:
- * - Pressing F or the left mouse button creates a new Bullet owned by this Player,
- *   positioned at the center of the player's current texture area and added to m_Bullets.
+ * - The tick's presses of F or the left mouse button are appended to the ProjectileStore
+ *   as one batch with this Player as the shooter, with the speed, damage and lifetime of
+ *   the FrameData Shot move. Each shot is centred where the player's
+ *   center was at the moment of the press and advanced by the time it has been flying since.
+ * - Firing restarts the attack one-shot, which plays over the movement clip.
+ *
+ * The shots are moved, collided and drawn with every other projectile in the same tick.
  *
- * Bullet lifecycle:
- * - Bullets whose x position is > 5000 or < -5000 are removed from m_Bullets and deleted.
- * - Remaining bullets are updated each frame via bullet->Update(dt).
+ * Melee:
+ * - A press of J or the right mouse button only raises the attack request; Game starts
+ *   the held weapon's move in the MeleeSystem after the player pass.
  *
- * Side effects: modifies m_Position, m_Texture, aiming_left, allocates/deletes Bullet instances,
- * and mutates m_Bullets.
+ * Side effects: modifies the hot velocity, the animator, m_FacingLeft and appends to the
+ * ProjectileStore.
  *
  * @param dt Frame delta time in seconds.
  */
 void Player::OnUpdate(float dt)
 {
+	Vector2 velocity = { 0, 0 };
 
-	if (IsKeyDown(KEY_A))
+	if (const float held = m_Input.Held(InputAction::MoveLeft); held > 0)
 	{
-		aiming_left = true; // Shoot left
-		m_Texture = LoadTexture(LEFT);
-		m_Position.x -= m_Velocity * dt;
+		m_FacingLeft = true; // Shoot left
+		velocity.x -= m_Speed * held;
 	}
 
-	if (IsKeyDown(KEY_D))
+	if (const float held = m_Input.Held(InputAction::MoveRight); held > 0)
 	{
-		aiming_left = false; // Shoot right
-		m_Texture = LoadTexture(RIGHT);
-		m_Position.x += m_Velocity * dt;
+		m_FacingLeft = false; // Shoot right
+		velocity.x += m_Speed * held;
 	}
 	// Priorities W and S keybinds over A and D
-	if (IsKeyDown(KEY_W))
+	if (const float held = m_Input.Held(InputAction::MoveUp); held > 0)
 	{
-		aiming_left = false; // Force to shoot right by default if not holding A or D
-		m_Texture = LoadTexture(UP);
-		m_Position.y -= m_Velocity * dt;
+		m_FacingLeft = false; // Force to shoot right by default if not holding A or D
+		velocity.y -= m_Speed * held;
 	}
 
-	if (IsKeyDown(KEY_S))
+	if (const float held = m_Input.Held(InputAction::MoveDown); held > 0)
 	{
-		aiming_left = false; // Force to shoot right by default if not holding A or D
-		m_Texture = LoadTexture(IDLE);
-		m_Position.y += m_Velocity * dt;
+		m_FacingLeft = false; // Force to shoot right by default if not holding A or D
+		velocity.y += m_Speed * held;
 	}
 
-	if (IsKeyPressed(KEY_F) || IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
-	{
-		Bullet* bullet = new Bullet(this, 1000.f, aiming_left);
-		// Set the bullet position in the middle of the player position
-		bullet->GetPosition() = 
-		{
-			static_cast<float>(m_Texture.width / 2) + m_Position.x,
-			static_cast<float>(m_Texture.height / 2) + m_Position.y
-		};
-		m_Bullets.push_back(bullet);
-	}
+	if (velocity.y < 0)
+		SetAnimState(AnimState::Up);
+	else if (velocity.y == 0 && velocity.x < 0)
+		SetAnimState(AnimState::WalkLeft);
+	else if (velocity.y == 0 && velocity.x > 0)
+		SetAnimState(AnimState::WalkRight);
+	else
+		SetAnimState(AnimState::Idle);
 
-	for (auto bullet : m_Bullets)
-	{
-		const float pos = bullet->GetPosition().x;
-		if (pos > 5000 || pos < -5000)
-		{
-			// Remove the bullet if its position is out of the screen
-			m_Bullets.erase(std::remove(m_Bullets.begin(), m_Bullets.end(), bullet), m_Bullets.end());
-			delete bullet;
-		}
-	}
+	m_AttackRequested = m_Input.attackPressed;
+	EntityHot& hot = Hot();
+	hot.velocity = velocity;
+	if (m_Input.fireCount == 0) return;
 
-	for (auto bullet : m_Bullets)
-		bullet->Update(dt);
+	PlayAnimation(AnimState::Attack);
+	const Texture2D& sprite = TextureCache::Get(GetShotTexture());
+	const Vector2 size = { sprite.width * 0.5f, sprite.height * 0.5f };
+	constexpr const FrameData::Move& shot = FrameData::GetMove(FrameData::MoveId::Shot);
+	const Vector2 shotVelocity = { m_FacingLeft ? -shot.velocity.x : shot.velocity.x, shot.velocity.y };
+	const float left = hot.position.x + hot.halfExtents.x - size.x * 0.5f;
+	const float top = hot.position.y + hot.halfExtents.y - size.y * 0.5f;
 
+	const ProjectileBatch batch = ProjectileStore::Append(
+		m_Input.fireCount, *this, GetShotTexture(), size, shot.damage, shot.lifetime);
+	for (size_t i = 0; i < batch.count; i++)
+	{
+		// The press happened `offset` seconds before the end of the tick. Both the player
+		// and the shot are integrated over the whole tick afterwards, so start the shot
+		// where that leaves it at press position + shot velocity * offset.
+		const float offset = std::clamp(m_Input.fireOffsets[i], 0.f, dt);
+		const float early = dt - offset;
+		batch.x[i] = left + (velocity.x - shotVelocity.x) * early;
+		batch.y[i] = top + (velocity.y - shotVelocity.y) * early;
+		batch.vx[i] = shotVelocity.x;
+		batch.vy[i] = shotVelocity.y;
+	}
 }
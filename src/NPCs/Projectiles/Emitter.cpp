@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "spdlog/spdlog.h"
+#include "NPCs/Projectiles/Emitter.h"
+#include "NPCs/Projectiles/ProjectileStore.h"
+#include "NPCs/Entity.h"
+
+std::vector<EmitterPattern> EmitterPatterns::s_Patterns;
+
+namespace
+{
+	constexpr float DegToRad = 3.14159265358979f / 180.f;
+}
+
+/**
+ * @brief Loads a pattern file.
+ *
+ * Parses `texture` and `pattern` lines (see EmitterPatterns) and resolves each pattern's
+ * texture and shot size. Any unknown key, shape or missing value fails the whole file.
+ *
+ * @param path Path to the pattern file.
+ * @return true if the patterns were loaded; false (and the old patterns kept) on error.
+ */
+bool EmitterPatterns::Load(const char* path)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		spdlog::error("Couldn't open patterns '{}'", path);
+		return false;
+	}
+
+	std::vector<EmitterPattern> patterns;
+	TextureId texture = 0;
+	bool hasTexture = false;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (line.empty() || line.rfind("//", 0) == 0)
+			continue;
+
+		std::istringstream fields(line);
+		std::string key;
+		fields >> key;
+		if (key == "texture")
+		{
+			std::string texturePath;
+			fields >> texturePath;
+			if (fields.fail())
+			{
+				spdlog::error("Patterns '{}': missing texture path", path);
+				return false;
+			}
+			texture = TextureCache::Load(texturePath.c_str());
+			hasTexture = true;
+			continue;
+		}
+		if (key != "pattern")
+		{
+			spdlog::error("Patterns '{}': unknown key '{}'", path, key);
+			return false;
+		}
+
+		std::string name, shape;
+		EmitterPattern pattern{};
+		fields >> name >> shape >> pattern.count >> pattern.speed >> pattern.spread
+			>> pattern.spin >> pattern.interval >> pattern.lifetime >> pattern.damage;
+		if (fields.fail() || pattern.count == 0 || pattern.lifetime <= 0)
+		{
+			spdlog::error("Patterns '{}': bad values for pattern '{}'", path, name);
+			return false;
+		}
+		if (!hasTexture)
+		{
+			spdlog::error("Patterns '{}': pattern '{}' comes before any texture", path, name);
+			return false;
+		}
+
+		if (shape == "radial")
+			pattern.shape = EmitterShape::Radial;
+		else if (shape == "spiral")
+			pattern.shape = EmitterShape::Spiral;
+		else if (shape == "aimed")
+			pattern.shape = EmitterShape::Aimed;
+		else
+		{
+			spdlog::error("Patterns '{}': unknown shape '{}'", path, shape);
+			return false;
+		}
+
+		const Texture2D& sprite = TextureCache::Get(texture);
+		pattern.name = StringInterner::Intern(name);
+		pattern.texture = texture;
+		pattern.size = { sprite.width * 0.5f, sprite.height * 0.5f };
+		patterns.push_back(pattern);
+	}
+
+	s_Patterns = std::move(patterns);
+	spdlog::info("Loaded {} emitter patterns from '{}'", s_Patterns.size(), path);
+	return true;
+}
+
+/**
+ * @brief Finds a loaded pattern by name.
+ *
+ * @param name Name of the pattern.
+ * @return The pattern, or nullptr if none was loaded under that name.
+ */
+const EmitterPattern* EmitterPatterns::Find(std::string_view name)
+{
+	const NameId id = StringInterner::Find(name);
+	for (const EmitterPattern& pattern : s_Patterns)
+	{
+		if (pattern.name == id)
+			return &pattern;
+	}
+	return nullptr;
+}
+
+/**
+ * @brief Attaches a pattern to an entity.
+ *
+ * The heading starts pointing down.
+ *
+ * @param owner Entity the shots come from.
+ * @param pattern Pattern to fire.
+ * @param tick Tick of the first volley.
+ */
+void EmitterSystem::Attach(Entity& owner, const EmitterPattern& pattern, uint64_t tick)
+{
+	m_Emitters.push_back({ &owner, &pattern, tick, 90.f });
+}
+
+/**
+ * @brief Removes every emitter attached to an entity.
+ *
+ * @param owner Entity that is about to be destroyed.
+ */
+void EmitterSystem::Detach(const Entity& owner)
+{
+	m_Emitters.erase(
+		std::remove_if(m_Emitters.begin(), m_Emitters.end(),
+			[&](const Emitter& emitter) { return emitter.owner == &owner; }),
+		m_Emitters.end()
+	);
+}
+
+/**
+ * @brief Fires every volley due on this tick.
+ *
+ * Each volley is appended to the ProjectileStore as a single batch from the owner's
+ * center. Shot directions start at the edge of the spread and advance by a fixed
+ * rotation, so only the first direction and the step need cos/sin. A full 360° volley
+ * spaces its shots so the last one doesn't overlap the first.
+ *
+ * The owner is recorded as the shooter. Dead owners don't fire.
+ *
+ * @param tick Tick being simulated.
+ * @param target Entity aimed patterns fire at, or nullptr.
+ * @return Number of shots fired.
+ */
+size_t EmitterSystem::Update(uint64_t tick, Entity* target)
+{
+	size_t fired = 0;
+	for (Emitter& emitter : m_Emitters)
+	{
+		if (emitter.nextTick > tick) continue;
+		const EmitterPattern& pattern = *emitter.pattern;
+		emitter.nextTick = tick + std::max(pattern.interval, 1u);
+		if (!emitter.owner->IsAlive()) continue;
+
+		const Rectangle bounds = emitter.owner->GetBounds();
+		const Vector2 center = { bounds.x + bounds.width * 0.5f, bounds.y + bounds.height * 0.5f };
+
+		float heading = emitter.heading;
+		if (pattern.shape == EmitterShape::Aimed && target != nullptr && target->IsAlive())
+		{
+			const Rectangle aim = target->GetBounds();
+			heading = std::atan2(aim.y + aim.height * 0.5f - center.y, aim.x + aim.width * 0.5f - center.x) / DegToRad;
+		}
+		else if (pattern.shape == EmitterShape::Spiral)
+			emitter.heading = std::fmod(emitter.heading + pattern.spin, 360.f);
+
+		const bool ring = pattern.spread >= 360.f;
+		const float step = ring ? 360.f / pattern.count
+			: pattern.count > 1 ? pattern.spread / (pattern.count - 1) : 0.f;
+		const float first = ring ? heading : heading - pattern.spread * 0.5f;
+
+		const uint32_t lifetime = std::max(static_cast<uint32_t>(pattern.lifetime / m_TickInterval), 1u);
+		const ProjectileBatch batch = ProjectileStore::Append(
+			pattern.count, *emitter.owner, pattern.texture, pattern.size, pattern.damage, lifetime);
+
+		const float stepCos = std::cos(step * DegToRad);
+		const float stepSin = std::sin(step * DegToRad);
+		float dirX = std::cos(first * DegToRad);
+		float dirY = std::sin(first * DegToRad);
+		const float left = center.x - pattern.size.x * 0.5f;
+		const float top = center.y - pattern.size.y * 0.5f;
+		for (size_t i = 0; i < batch.count; i++)
+		{
+			batch.x[i] = left;
+			batch.y[i] = top;
+			batch.vx[i] = dirX * pattern.speed;
+			batch.vy[i] = dirY * pattern.speed;
+
+			const float nextX = dirX * stepCos - dirY * stepSin;
+			dirY = dirX * stepSin + dirY * stepCos;
+			dirX = nextX;
+		}
+		fired += batch.count;
+	}
+	return fired;
+}
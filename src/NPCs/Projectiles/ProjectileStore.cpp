@@ -0,0 +1,401 @@
+#include <algorithm>
+#include <cmath>
+
+#include "NPCs/Projectiles/ProjectileStore.h"
+#include "NPCs/Entity.h"
+#include "Level/Level.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PROJECTILE_SIMD 1
+#endif
+
+namespace
+{
+	constexpr uint32_t NullBin = UINT32_MAX;
+
+	int CellOf(float coordinate, float cellSize)
+	{
+		return static_cast<int>(std::floor(coordinate / cellSize));
+	}
+}
+
+std::vector<float> ProjectileStore::s_X;
+std::vector<float> ProjectileStore::s_Y;
+std::vector<float> ProjectileStore::s_VX;
+std::vector<float> ProjectileStore::s_VY;
+std::vector<float> ProjectileStore::s_Width;
+std::vector<float> ProjectileStore::s_Height;
+std::vector<float> ProjectileStore::s_Damage;
+std::vector<uint8_t> ProjectileStore::s_Layer;
+std::vector<EntityId> ProjectileStore::s_Shooter;
+std::vector<uint8_t> ProjectileStore::s_Dead;
+std::vector<TextureId> ProjectileStore::s_Texture;
+std::vector<ProjectileHandle> ProjectileStore::s_Handle;
+std::vector<TimerId> ProjectileStore::s_Timer;
+std::vector<uint32_t> ProjectileStore::s_BinStart;
+std::vector<uint32_t> ProjectileStore::s_BinCursor;
+std::vector<uint32_t> ProjectileStore::s_RowBin;
+std::vector<uint32_t> ProjectileStore::s_BinRow;
+std::vector<float> ProjectileStore::s_BinLeft;
+std::vector<float> ProjectileStore::s_BinTop;
+std::vector<float> ProjectileStore::s_BinRight;
+std::vector<float> ProjectileStore::s_BinBottom;
+float ProjectileStore::s_BinReach = 0;
+std::vector<uint32_t> ProjectileStore::s_Rows;
+std::vector<ProjectileHandle> ProjectileStore::s_FreeHandles;
+TimingWheel ProjectileStore::s_Lifetimes;
+
+/**
+ * @brief Adds a batch of projectiles that share everything but position and velocity.
+ *
+ * Every row gets a handle and a lifetime timer; the positions and velocities are left
+ * zeroed for the caller to fill in through the returned batch. The batch pointers are
+ * only valid until the next Append or Compact.
+ *
+ * Shots from players go on CollisionLayer::PlayerProjectile, everything else on
+ * CollisionLayer::EnemyProjectile.
+ *
+ * @param count Number of projectiles to add.
+ * @param shooter Entity firing the projectiles.
+ * @param texture Sprite of the new projectiles.
+ * @param size Full width and height of each projectile.
+ * @param damage Damage each projectile deals on a hit.
+ * @param lifetime Ticks until unspent projectiles despawn, counted from the last Advance.
+ * @return The appended rows.
+ */
+ProjectileBatch ProjectileStore::Append(size_t count, const Entity& shooter, TextureId texture, Vector2 size, float damage, uint32_t lifetime)
+{
+	const uint32_t layer = shooter.GetCollisionLayer() == CollisionLayer::Player
+		? CollisionLayer::PlayerProjectile
+		: CollisionLayer::EnemyProjectile;
+	const uint64_t expiresAt = s_Lifetimes.GetTick() + lifetime;
+
+	const size_t first = s_X.size();
+	const size_t end = first + count;
+	s_X.resize(end);
+	s_Y.resize(end);
+	s_VX.resize(end);
+	s_VY.resize(end);
+	s_Width.resize(end, size.x);
+	s_Height.resize(end, size.y);
+	s_Damage.resize(end, damage);
+	s_Layer.resize(end, static_cast<uint8_t>(layer));
+	s_Shooter.resize(end, shooter.GetId());
+	s_Dead.resize(end, 0);
+	s_Texture.resize(end, texture);
+	s_Handle.resize(end);
+	s_Timer.resize(end);
+
+	for (size_t row = first; row < end; row++)
+	{
+		ProjectileHandle handle;
+		if (!s_FreeHandles.empty())
+		{
+			handle = s_FreeHandles.back();
+			s_FreeHandles.pop_back();
+		}
+		else
+		{
+			handle = static_cast<ProjectileHandle>(s_Rows.size());
+			s_Rows.push_back(0);
+		}
+		s_Rows[handle] = static_cast<uint32_t>(row);
+		s_Handle[row] = handle;
+		s_Timer[row] = s_Lifetimes.Schedule(expiresAt, &ProjectileStore::Expire, nullptr, handle);
+	}
+
+	return { s_X.data() + first, s_Y.data() + first, s_VX.data() + first, s_VY.data() + first, count };
+}
+
+/**
+ * @brief Fires the lifetime timers due on a tick.
+ *
+ * @param tick Tick being simulated.
+ */
+void ProjectileStore::Advance(uint64_t tick)
+{
+	s_Lifetimes.Advance(tick);
+}
+
+/**
+ * @brief Lifetime timer callback: the projectile has flown for its whole lifetime.
+ *
+ * @param userData Unused.
+ * @param handle Handle of the projectile, passed as the timer's tag.
+ */
+void ProjectileStore::Expire(void*, uint32_t handle)
+{
+	const uint32_t row = s_Rows[handle];
+	s_Timer[row] = NullTimer;
+	s_Dead[row] = 1;
+}
+
+/**
+ * @brief Advances every projectile's position by its velocity.
+ *
+ * Streams through the four position and velocity arrays four rows at a time, with a
+ * scalar loop for the remainder (and for targets without SSE2). Dead rows move too;
+ * skipping them would cost more than it saves.
+ *
+ * @param dt Time elapsed since the last tick, in seconds.
+ */
+void ProjectileStore::Integrate(float dt)
+{
+	const size_t count = s_X.size();
+	float* x = s_X.data();
+	float* y = s_Y.data();
+	const float* vx = s_VX.data();
+	const float* vy = s_VY.data();
+
+	size_t i = 0;
+#ifdef PROJECTILE_SIMD
+	const __m128 step = _mm_set1_ps(dt);
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), step)));
+		_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), step)));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		x[i] += vx[i] * dt;
+		y[i] += vy[i] * dt;
+	}
+}
+
+/**
+ * @brief Hashes a grid cell to its bucket.
+ */
+uint32_t ProjectileStore::BinOf(int column, int row)
+{
+	return (static_cast<uint32_t>(column) * 73856093u ^ static_cast<uint32_t>(row) * 19349663u) & (BinCount - 1);
+}
+
+/**
+ * @brief Counting-sorts the live projectiles into the collision grid by the cell of their centre.
+ *
+ * One pass picks every live row's bucket and counts them, a prefix sum turns the
+ * counts into offsets, and a second pass scatters the rows and their bounds into
+ * bucket order. Rows keep their store order within a bucket. Nothing allocates once
+ * the arrays have grown to the largest projectile count seen.
+ */
+void ProjectileStore::Bin()
+{
+	const size_t count = s_X.size();
+	s_BinStart.assign(BinCount + 1, 0);
+	s_RowBin.resize(count);
+	float reach = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (s_Dead[i])
+		{
+			s_RowBin[i] = NullBin;
+			continue;
+		}
+		const float halfWidth = s_Width[i] * 0.5f;
+		const float halfHeight = s_Height[i] * 0.5f;
+		const uint32_t bin = BinOf(CellOf(s_X[i] + halfWidth, CellSize), CellOf(s_Y[i] + halfHeight, CellSize));
+		s_RowBin[i] = bin;
+		s_BinStart[bin + 1]++;
+		reach = std::max(reach, std::max(halfWidth, halfHeight));
+	}
+	s_BinReach = reach;
+
+	for (uint32_t bin = 0; bin < BinCount; bin++)
+		s_BinStart[bin + 1] += s_BinStart[bin];
+	s_BinCursor.assign(s_BinStart.begin(), s_BinStart.end() - 1);
+
+	const size_t binned = s_BinStart[BinCount];
+	s_BinRow.resize(binned);
+	s_BinLeft.resize(binned);
+	s_BinTop.resize(binned);
+	s_BinRight.resize(binned);
+	s_BinBottom.resize(binned);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (s_RowBin[i] == NullBin) continue;
+		const uint32_t slot = s_BinCursor[s_RowBin[i]]++;
+		s_BinRow[slot] = static_cast<uint32_t>(i);
+		s_BinLeft[slot] = s_X[i];
+		s_BinTop[slot] = s_Y[i];
+		s_BinRight[slot] = s_X[i] + s_Width[i];
+		s_BinBottom[slot] = s_Y[i] + s_Height[i];
+	}
+}
+
+/**
+ * @brief Resolves the projectiles near one entity.
+ *
+ * Visits the grid cells that could hold the centre of a projectile touching the
+ * target's bounds and AABB-tests each bucket's projectiles four at a time, which
+ * yields a bit per overlapping one; only those are checked for liveness, against the
+ * target's collision mask and for having been fired by the target itself. Each hit
+ * applies the projectile's damage, queues a Debug-level Combat event and kills the
+ * projectile. Once the target dies, no further projectile hits it, even later in the
+ * same batch of four, and the search stops. Two cells sharing a bucket only cost a
+ * second test: a projectile that hit is already dead.
+ *
+ * @param target Entity to test.
+ * @return Number of projectiles that hit the target.
+ */
+uint32_t ProjectileStore::CollideTarget(Entity& target)
+{
+	if (!target.IsAlive() || !target.CollidesWithLayer(CollisionLayer::PlayerProjectile | CollisionLayer::EnemyProjectile))
+		return 0;
+
+	const Rectangle b = target.GetBounds();
+	const float right = b.x + b.width;
+	const float bottom = b.y + b.height;
+	uint32_t hits = 0;
+
+	auto hit = [&](size_t row) {
+		// A projectile only hits a live target, even within one batch of four
+		if (!target.IsAlive() || s_Dead[row] || !target.CollidesWithLayer(s_Layer[row]) || s_Shooter[row] == target.GetId()) return;
+		target.TakeDamage(s_Damage[row]);
+		EventLog::Log<LogLevel::Debug>(LogCategory::Combat, "Projectile hit for {:.0f} damage, {:.0f} hp left", s_Damage[row], target.GetHp());
+		s_Dead[row] = 1;
+		hits++;
+	};
+
+	// Same test as Entity::CheckCollision: boxes that only touch still collide
+	const int firstColumn = CellOf(b.x - s_BinReach, CellSize), lastColumn = CellOf(right + s_BinReach, CellSize);
+	const int firstRow = CellOf(b.y - s_BinReach, CellSize), lastRow = CellOf(bottom + s_BinReach, CellSize);
+#ifdef PROJECTILE_SIMD
+	const __m128 left4 = _mm_set1_ps(b.x);
+	const __m128 top4 = _mm_set1_ps(b.y);
+	const __m128 right4 = _mm_set1_ps(right);
+	const __m128 bottom4 = _mm_set1_ps(bottom);
+#endif
+	for (int row = firstRow; row <= lastRow; row++)
+	{
+		for (int column = firstColumn; column <= lastColumn; column++)
+		{
+			const uint32_t bin = BinOf(column, row);
+			size_t i = s_BinStart[bin];
+			const size_t end = s_BinStart[bin + 1];
+#ifdef PROJECTILE_SIMD
+			for (; i + 4 <= end; i += 4)
+			{
+				const __m128 overlapX = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(s_BinLeft.data() + i), right4),
+					_mm_cmpge_ps(_mm_loadu_ps(s_BinRight.data() + i), left4));
+				const __m128 overlapY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(s_BinTop.data() + i), bottom4),
+					_mm_cmpge_ps(_mm_loadu_ps(s_BinBottom.data() + i), top4));
+				const int mask = _mm_movemask_ps(_mm_and_ps(overlapX, overlapY));
+				if (mask == 0) continue;
+				for (int lane = 0; lane < 4; lane++)
+				{
+					if (mask & (1 << lane))
+						hit(s_BinRow[i + lane]);
+				}
+				if (!target.IsAlive()) return hits;
+			}
+#endif
+			for (; i < end && target.IsAlive(); i++)
+			{
+				if (s_BinLeft[i] <= right && s_BinRight[i] >= b.x && s_BinTop[i] <= bottom && s_BinBottom[i] >= b.y)
+					hit(s_BinRow[i]);
+			}
+			if (!target.IsAlive()) return hits;
+		}
+	}
+	return hits;
+}
+
+/**
+ * @brief Kills every projectile whose center is inside a solid tile.
+ *
+ * One grid lookup per projectile instead of a BVH query per box; projectiles are
+ * small next to tiles, so the center is close enough.
+ *
+ * @param level Level to test against.
+ */
+void ProjectileStore::CollideLevel(const Level& level)
+{
+	const size_t count = s_X.size();
+	for (size_t i = 0; i < count; i++)
+	{
+		if (s_Dead[i]) continue;
+		if (level.IsSolidAt(s_X[i] + s_Width[i] * 0.5f, s_Y[i] + s_Height[i] * 0.5f))
+			s_Dead[i] = 1;
+	}
+}
+
+/**
+ * @brief Removes the projectiles killed this tick.
+ *
+ * Slides the surviving rows down over the dead ones in a single pass, so spawn (and
+ * draw) order is kept, and updates their handles' rows. Dead projectiles free their
+ * handle and cancel their lifetime timer if it hasn't fired yet.
+ */
+void ProjectileStore::Compact()
+{
+	const size_t count = s_X.size();
+	size_t kept = 0;
+	for (size_t row = 0; row < count; row++)
+	{
+		if (s_Dead[row])
+		{
+			if (s_Timer[row] != NullTimer)
+				s_Lifetimes.Cancel(s_Timer[row]);
+			s_FreeHandles.push_back(s_Handle[row]);
+			continue;
+		}
+
+		if (kept != row)
+		{
+			s_X[kept] = s_X[row];
+			s_Y[kept] = s_Y[row];
+			s_VX[kept] = s_VX[row];
+			s_VY[kept] = s_VY[row];
+			s_Width[kept] = s_Width[row];
+			s_Height[kept] = s_Height[row];
+			s_Damage[kept] = s_Damage[row];
+			s_Layer[kept] = s_Layer[row];
+			s_Shooter[kept] = s_Shooter[row];
+			s_Dead[kept] = 0;
+			s_Texture[kept] = s_Texture[row];
+			s_Handle[kept] = s_Handle[row];
+			s_Timer[kept] = s_Timer[row];
+			s_Rows[s_Handle[kept]] = static_cast<uint32_t>(kept);
+		}
+		kept++;
+	}
+
+	s_X.resize(kept);
+	s_Y.resize(kept);
+	s_VX.resize(kept);
+	s_VY.resize(kept);
+	s_Width.resize(kept);
+	s_Height.resize(kept);
+	s_Damage.resize(kept);
+	s_Layer.resize(kept);
+	s_Shooter.resize(kept);
+	s_Dead.resize(kept);
+	s_Texture.resize(kept);
+	s_Handle.resize(kept);
+	s_Timer.resize(kept);
+}
+
+/**
+ * @brief Records a sprite for every live projectile on screen.
+ *
+ * Projectiles outside the view are skipped here, on the simulation thread, so they
+ * never reach the snapshot or the render thread.
+ *
+ * @param out Snapshot of the tick that just finished.
+ * @param view World-space rectangle on screen.
+ */
+void ProjectileStore::Record(RenderSnapshot& out, const Rectangle& view)
+{
+	const float right = view.x + view.width;
+	const float bottom = view.y + view.height;
+	const size_t count = s_X.size();
+	for (size_t i = 0; i < count; i++)
+	{
+		if (s_Dead[i]) continue;
+		if (s_X[i] > right || s_X[i] + s_Width[i] < view.x || s_Y[i] > bottom || s_Y[i] + s_Height[i] < view.y)
+			continue;
+		out.Sprite({ s_X[i], s_Y[i], s_Width[i], s_Height[i] }, s_Texture[i]);
+	}
+}
@@ -0,0 +1,21 @@
+#include "Physics/Broadphase.h"
+#include "Physics/BruteForceBroadphase.h"
+#include "Physics/SweepAndPrune.h"
+
+/**
+ * @brief Creates the broadphase implementation selected for a scene.
+ *
+ * @param type Which implementation to build.
+ * @return Owning pointer to the new, empty broadphase.
+ */
+std::unique_ptr<Broadphase> CreateBroadphase(BroadphaseType type)
+{
+	switch (type)
+	{
+	case BroadphaseType::BruteForce:
+		return std::make_unique<BruteForceBroadphase>();
+	case BroadphaseType::SweepAndPrune:
+	default:
+		return std::make_unique<SweepAndPrune>();
+	}
+}
@@ -0,0 +1,129 @@
+#include <algorithm>
+
+#include "Physics/BruteForceBroadphase.h"
+
+/**
+ * @brief Registers a proxy, reusing a free slot when one is available.
+ *
+ * @return Handle of the new proxy.
+ */
+ProxyId BruteForceBroadphase::CreateProxy(const Rectangle& bounds, uint32_t layer, uint32_t mask, void* userData)
+{
+	Proxy proxy{ bounds, layer, mask, userData };
+	if (!m_FreeList.empty())
+	{
+		ProxyId id = m_FreeList.back();
+		m_FreeList.pop_back();
+		m_Proxies[id] = proxy;
+		return id;
+	}
+	m_Proxies.push_back(proxy);
+	return static_cast<ProxyId>(m_Proxies.size() - 1);
+}
+
+/**
+ * @brief Updates the bounds of an existing proxy.
+ */
+void BruteForceBroadphase::MoveProxy(ProxyId id, const Rectangle& bounds)
+{
+	m_Proxies[id].bounds = bounds;
+}
+
+/**
+ * @brief Removes a proxy. A destroyed proxy keeps its slot with an empty layer so it never pairs.
+ */
+void BruteForceBroadphase::DestroyProxy(ProxyId id)
+{
+	m_Proxies[id].layer = 0;
+	m_Proxies[id].mask = 0;
+	m_FreeList.push_back(id);
+}
+
+/**
+ * @brief Tests every proxy against every other one.
+ *
+ * The layer/mask filter runs before the bounds test, so disallowed pairs cost one AND.
+ */
+void BruteForceBroadphase::QueryPairs(std::vector<BroadphasePair>& pairs)
+{
+	const size_t count = m_Proxies.size();
+	for (size_t i = 0; i < count; i++)
+	{
+		const Proxy& a = m_Proxies[i];
+		for (size_t j = i + 1; j < count; j++)
+		{
+			const Proxy& b = m_Proxies[j];
+			if (!((a.mask & b.layer) | (b.mask & a.layer)))
+				continue;
+
+			if (a.bounds.x + a.bounds.width < b.bounds.x || b.bounds.x + b.bounds.width < a.bounds.x)
+				continue;
+			if (a.bounds.y + a.bounds.height < b.bounds.y || b.bounds.y + b.bounds.height < a.bounds.y)
+				continue;
+
+			pairs.push_back({ a.userData, b.userData });
+		}
+	}
+}
+
+
+/**
+ * @brief Tests every live proxy against a region.
+ *
+ * Destroyed slots are recognised by their empty layer.
+ */
+void BruteForceBroadphase::QueryRegion(const Rectangle& region, std::vector<void*>& out)
+{
+	for (const Proxy& proxy : m_Proxies)
+	{
+		if (proxy.layer == 0)
+			continue;
+		if (proxy.bounds.x + proxy.bounds.width < region.x || region.x + region.width < proxy.bounds.x)
+			continue;
+		if (proxy.bounds.y + proxy.bounds.height < region.y || region.y + region.height < proxy.bounds.y)
+			continue;
+		out.push_back(proxy.userData);
+	}
+}
+
+/**
+ * @brief Tests every live proxy against a region and keeps the `limit` closest.
+ *
+ * Closest means by squared distance between centres, ties going to the lower slot; the
+ * best `limit` so far are kept insertion-sorted in a reused buffer. Destroyed slots
+ * have an empty layer and never match.
+ */
+void BruteForceBroadphase::QueryNearby(const Rectangle& region, uint32_t layers, size_t limit, std::vector<void*>& out)
+{
+	if (limit == 0) return;
+
+	const float centerX = region.x + region.width * 0.5f;
+	const float centerY = region.y + region.height * 0.5f;
+	m_Nearest.clear();
+	for (ProxyId id = 0; id < m_Proxies.size(); id++)
+	{
+		const Proxy& proxy = m_Proxies[id];
+		if (!(proxy.layer & layers))
+			continue;
+		if (proxy.bounds.x + proxy.bounds.width < region.x || region.x + region.width < proxy.bounds.x)
+			continue;
+		if (proxy.bounds.y + proxy.bounds.height < region.y || region.y + region.height < proxy.bounds.y)
+			continue;
+
+		const float dx = proxy.bounds.x + proxy.bounds.width * 0.5f - centerX;
+		const float dy = proxy.bounds.y + proxy.bounds.height * 0.5f - centerY;
+		const float distance = dx * dx + dy * dy;
+		const std::pair<float, ProxyId> candidate = { distance, id };
+		if (m_Nearest.size() < limit)
+			m_Nearest.push_back(candidate);
+		else if (candidate < m_Nearest.back())
+			m_Nearest.back() = candidate;
+		else
+			continue;
+		for (size_t i = m_Nearest.size() - 1; i > 0 && m_Nearest[i] < m_Nearest[i - 1]; i--)
+			std::swap(m_Nearest[i], m_Nearest[i - 1]);
+	}
+
+	for (const auto& nearest : m_Nearest)
+		out.push_back(m_Proxies[nearest.second].userData);
+}
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Physics/PushboxSolver.h"
+#include "Physics/CollisionLayer.h"
+#include "NPCs/Entity.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PUSHBOX_SIMD 1
+#endif
+
+/**
+ * @brief Separates the overlapping pushable bodies among the broadphase pairs.
+ *
+ * Gathers the contacts and their bodies in EntityId order, loads every body's centre
+ * and half extents from its hot record, then runs up to MaxIterations Jacobi
+ * iterations and writes the centres back as positions.
+ *
+ * @param pairs Broadphase pairs of the tick.
+ * @return Number of iterations that found an overlap.
+ */
+uint32_t PushboxSolver::Solve(const std::vector<BroadphasePair>& pairs)
+{
+	m_Contacts.clear();
+	m_Bodies.clear();
+	for (const BroadphasePair& pair : pairs)
+	{
+		Entity* a = static_cast<Entity*>(pair.userDataA);
+		Entity* b = static_cast<Entity*>(pair.userDataB);
+		if (!(a->GetCollisionLayer() & CollisionLayer::Pushable) || !(b->GetCollisionLayer() & CollisionLayer::Pushable))
+			continue;
+		if (!a->IsAlive() || !b->IsAlive()) continue;
+
+		if (b->GetId() < a->GetId())
+			std::swap(a, b);
+		m_Contacts.push_back({ a, b });
+		m_Bodies.push_back(a);
+		m_Bodies.push_back(b);
+	}
+	if (m_Contacts.empty()) return 0;
+
+	const auto byId = [](const Entity* a, const Entity* b) { return a->GetId() < b->GetId(); };
+	std::sort(m_Contacts.begin(), m_Contacts.end(), [](const Contact& a, const Contact& b) {
+		return a.a->GetId() != b.a->GetId() ? a.a->GetId() < b.a->GetId() : a.b->GetId() < b.b->GetId();
+	});
+	std::sort(m_Bodies.begin(), m_Bodies.end(), byId);
+	m_Bodies.erase(std::unique(m_Bodies.begin(), m_Bodies.end()), m_Bodies.end());
+
+	const size_t bodyCount = m_Bodies.size();
+	m_CenterX.resize(bodyCount);
+	m_CenterY.resize(bodyCount);
+	m_HalfX.resize(bodyCount);
+	m_HalfY.resize(bodyCount);
+	m_DeltaX.resize(bodyCount);
+	m_DeltaY.resize(bodyCount);
+	m_Share.assign(bodyCount, 0.f);
+	for (size_t i = 0; i < bodyCount; i++)
+	{
+		const EntityHot& hot = m_Bodies[i]->Hot();
+		m_HalfX[i] = hot.halfExtents.x;
+		m_HalfY[i] = hot.halfExtents.y;
+		m_CenterX[i] = hot.position.x + hot.halfExtents.x;
+		m_CenterY[i] = hot.position.y + hot.halfExtents.y;
+	}
+
+	// Padding contacts have no reach, so they never overlap
+	const size_t contactCount = m_Contacts.size();
+	const size_t padded = (contactCount + 3) & ~size_t{ 3 };
+	m_BodyA.resize(contactCount);
+	m_BodyB.resize(contactCount);
+	m_ReachX.assign(padded, 0.f);
+	m_ReachY.assign(padded, 0.f);
+	m_DX.assign(padded, 0.f);
+	m_DY.assign(padded, 0.f);
+	m_PushX.resize(padded);
+	m_PushY.resize(padded);
+	for (size_t i = 0; i < contactCount; i++)
+	{
+		const uint32_t a = static_cast<uint32_t>(std::lower_bound(m_Bodies.begin(), m_Bodies.end(), m_Contacts[i].a, byId) - m_Bodies.begin());
+		const uint32_t b = static_cast<uint32_t>(std::lower_bound(m_Bodies.begin(), m_Bodies.end(), m_Contacts[i].b, byId) - m_Bodies.begin());
+		m_BodyA[i] = a;
+		m_BodyB[i] = b;
+		m_ReachX[i] = m_HalfX[a] + m_HalfX[b];
+		m_ReachY[i] = m_HalfY[a] + m_HalfY[b];
+		m_Share[a] += 1.f;
+		m_Share[b] += 1.f;
+	}
+	for (float& share : m_Share)
+		share = 1.f / share;
+
+	uint32_t iterations = 0;
+	while (iterations < MaxIterations && SolveContacts())
+		iterations++;
+
+	for (size_t i = 0; i < bodyCount; i++)
+	{
+		EntityHot& hot = m_Bodies[i]->Hot();
+		hot.position.x = m_CenterX[i] - m_HalfX[i];
+		hot.position.y = m_CenterY[i] - m_HalfY[i];
+	}
+	return iterations;
+}
+
+/**
+ * @brief Runs one Jacobi iteration over every contact.
+ *
+ * Gathers each contact's centre offset, computes every correction four contacts at a
+ * time, then sums the corrections per body in contact order and moves each body by
+ * its average. An overlapping pair is pushed apart along the axis it overlaps least,
+ * half of the overlap each; with no offset on that axis, the lower EntityId goes left
+ * (or up).
+ *
+ * @return false if no contact overlapped beyond Slop; nothing moved.
+ */
+bool PushboxSolver::SolveContacts()
+{
+	const size_t contactCount = m_Contacts.size();
+	const size_t padded = m_ReachX.size();
+	for (size_t i = 0; i < contactCount; i++)
+	{
+		m_DX[i] = m_CenterX[m_BodyB[i]] - m_CenterX[m_BodyA[i]];
+		m_DY[i] = m_CenterY[m_BodyB[i]] - m_CenterY[m_BodyA[i]];
+	}
+
+	bool overlapped = false;
+	size_t i = 0;
+#ifdef PUSHBOX_SIMD
+	const __m128 sign = _mm_set1_ps(-0.f);
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 one = _mm_set1_ps(1.f);
+	const __m128 slop = _mm_set1_ps(Slop);
+	int anyOverlap = 0;
+	for (; i < padded; i += 4)
+	{
+		const __m128 dx = _mm_loadu_ps(m_DX.data() + i);
+		const __m128 dy = _mm_loadu_ps(m_DY.data() + i);
+		const __m128 overlapX = _mm_sub_ps(_mm_loadu_ps(m_ReachX.data() + i), _mm_andnot_ps(sign, dx));
+		const __m128 overlapY = _mm_sub_ps(_mm_loadu_ps(m_ReachY.data() + i), _mm_andnot_ps(sign, dy));
+		const __m128 overlaps = _mm_and_ps(_mm_cmpgt_ps(overlapX, slop), _mm_cmpgt_ps(overlapY, slop));
+		const __m128 alongX = _mm_and_ps(overlaps, _mm_cmplt_ps(overlapX, overlapY));
+		const __m128 alongY = _mm_andnot_ps(alongX, overlaps);
+
+		// +-1 with the sign of the offset; zero offsets push b right/down
+		const __m128 directionX = _mm_or_ps(_mm_and_ps(sign, dx), one);
+		const __m128 directionY = _mm_or_ps(_mm_and_ps(sign, dy), one);
+		_mm_storeu_ps(m_PushX.data() + i, _mm_and_ps(alongX, _mm_mul_ps(_mm_mul_ps(overlapX, half), directionX)));
+		_mm_storeu_ps(m_PushY.data() + i, _mm_and_ps(alongY, _mm_mul_ps(_mm_mul_ps(overlapY, half), directionY)));
+		anyOverlap |= _mm_movemask_ps(overlaps);
+	}
+	overlapped = anyOverlap != 0;
+#else
+	for (; i < padded; i++)
+	{
+		const float overlapX = m_ReachX[i] - std::abs(m_DX[i]);
+		const float overlapY = m_ReachY[i] - std::abs(m_DY[i]);
+		const bool overlaps = overlapX > Slop && overlapY > Slop;
+		const bool alongX = overlaps && overlapX < overlapY;
+		m_PushX[i] = alongX ? overlapX * 0.5f * std::copysign(1.f, m_DX[i]) : 0.f;
+		m_PushY[i] = overlaps && !alongX ? overlapY * 0.5f * std::copysign(1.f, m_DY[i]) : 0.f;
+		overlapped = overlapped || overlaps;
+	}
+#endif
+	if (!overlapped) return false;
+
+	std::fill(m_DeltaX.begin(), m_DeltaX.end(), 0.f);
+	std::fill(m_DeltaY.begin(), m_DeltaY.end(), 0.f);
+	for (size_t c = 0; c < contactCount; c++)
+	{
+		m_DeltaX[m_BodyA[c]] -= m_PushX[c];
+		m_DeltaY[m_BodyA[c]] -= m_PushY[c];
+		m_DeltaX[m_BodyB[c]] += m_PushX[c];
+		m_DeltaY[m_BodyB[c]] += m_PushY[c];
+	}
+
+	const size_t bodyCount = m_Bodies.size();
+	for (size_t b = 0; b < bodyCount; b++)
+	{
+		m_CenterX[b] += m_DeltaX[b] * m_Share[b];
+		m_CenterY[b] += m_DeltaY[b] * m_Share[b];
+	}
+	return true;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+
+#include "Physics/StaticBVH.h"
+
+/**
+ * @brief Bakes a set of static colliders into the hierarchy.
+ *
+ * Any previous content is discarded. The colliders are reordered so that each
+ * leaf references a contiguous range.
+ *
+ * @param colliders World-space collider rectangles; taken by value and stored.
+ */
+void StaticBVH::Build(std::vector<Rectangle> colliders)
+{
+	m_Colliders = std::move(colliders);
+	m_Nodes.clear();
+	if (m_Colliders.empty()) return;
+
+	// A binary tree with LeafSize-sized leaves never needs more than 2n nodes
+	m_Nodes.reserve(2 * m_Colliders.size());
+	m_Nodes.push_back({});
+	BuildNode(0, 0, static_cast<uint32_t>(m_Colliders.size()));
+	m_Nodes.shrink_to_fit();
+}
+
+/**
+ * @brief Removes all colliders and nodes.
+ */
+void StaticBVH::Clear()
+{
+	m_Nodes.clear();
+	m_Colliders.clear();
+}
+
+/**
+ * @brief Recursively fills a node and its subtree.
+ *
+ * The node's bounds enclose colliders [first, first + count). Ranges larger than
+ * LeafSize are split at the median centroid along the longer axis of the bounds,
+ * which keeps the tree balanced and its depth logarithmic. The left child is
+ * emitted right after its parent so traversal stays depth-first in memory.
+ *
+ * @param nodeIndex Index of the node to fill in m_Nodes.
+ * @param first Index of the first collider covered by the node.
+ * @param count Number of colliders covered by the node.
+ */
+void StaticBVH::BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count)
+{
+	Node node{};
+	node.minX = node.minY = 1e30f;
+	node.maxX = node.maxY = -1e30f;
+	for (uint32_t i = first; i < first + count; i++)
+	{
+		const Rectangle& collider = m_Colliders[i];
+		node.minX = std::min(node.minX, collider.x);
+		node.minY = std::min(node.minY, collider.y);
+		node.maxX = std::max(node.maxX, collider.x + collider.width);
+		node.maxY = std::max(node.maxY, collider.y + collider.height);
+	}
+
+	if (count <= LeafSize)
+	{
+		node.rightOrFirst = first;
+		node.count = count;
+		m_Nodes[nodeIndex] = node;
+		return;
+	}
+
+	const bool splitX = (node.maxX - node.minX) >= (node.maxY - node.minY);
+	const uint32_t half = count / 2;
+	std::nth_element(m_Colliders.begin() + first, m_Colliders.begin() + first + half, m_Colliders.begin() + first + count,
+		[splitX](const Rectangle& a, const Rectangle& b) {
+			return splitX
+				? a.x + a.width * 0.5f < b.x + b.width * 0.5f
+				: a.y + a.height * 0.5f < b.y + b.height * 0.5f;
+		});
+
+	const uint32_t left = static_cast<uint32_t>(m_Nodes.size());
+	m_Nodes.push_back({});
+	BuildNode(left, first, half);
+
+	const uint32_t right = static_cast<uint32_t>(m_Nodes.size());
+	m_Nodes.push_back({});
+	BuildNode(right, first + half, count - half);
+
+	node.rightOrFirst = right;
+	node.count = 0;
+	m_Nodes[nodeIndex] = node;
+}
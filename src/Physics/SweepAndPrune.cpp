@@ -0,0 +1,279 @@
+#include <algorithm>
+#include <limits>
+
+#include "Physics/SweepAndPrune.h"
+
+/**
+ * @brief Registers a proxy. It joins the sorted interval list on the next query.
+ *
+ * @return Handle of the new proxy.
+ */
+ProxyId SweepAndPrune::CreateProxy(const Rectangle& bounds, uint32_t layer, uint32_t mask, void* userData)
+{
+	Proxy proxy{ bounds, layer, mask, userData, true };
+	ProxyId id;
+	if (!m_FreeList.empty())
+	{
+		id = m_FreeList.back();
+		m_FreeList.pop_back();
+		m_Proxies[id] = proxy;
+	}
+	else
+	{
+		m_Proxies.push_back(proxy);
+		id = static_cast<ProxyId>(m_Proxies.size() - 1);
+	}
+	m_Added.push_back(id);
+	m_Dirty = true;
+	return id;
+}
+
+/**
+ * @brief Updates the bounds of a proxy. The sorted order is repaired lazily on the next query.
+ */
+void SweepAndPrune::MoveProxy(ProxyId id, const Rectangle& bounds)
+{
+	m_Proxies[id].bounds = bounds;
+	m_Dirty = true;
+}
+
+/**
+ * @brief Removes a proxy.
+ *
+ * The slot is not reused until the next query has dropped it from the interval list,
+ * so a stale interval can never alias a newly created proxy.
+ */
+void SweepAndPrune::DestroyProxy(ProxyId id)
+{
+	m_Proxies[id].alive = false;
+	m_PendingFree.push_back(id);
+	m_Dirty = true;
+}
+
+/**
+ * @brief Brings the interval list up to date with the proxies.
+ *
+ * Dead intervals are removed with a stable compaction (the list stays sorted), new
+ * proxies are appended at the end for the insertion sort to place, and every interval
+ * gets a fresh copy of its proxy's bounds and filter bits, then the order is repaired.
+ * Also finds the widest interval for QueryRegion. Does nothing if no proxy changed
+ * since the last call, so several queries in a row only pay for it once.
+ */
+void SweepAndPrune::Refresh()
+{
+	if (!m_Dirty) return;
+	m_Dirty = false;
+
+	if (!m_PendingFree.empty())
+	{
+		m_Intervals.erase(
+			std::remove_if(m_Intervals.begin(), m_Intervals.end(),
+				[&](const Interval& interval) {
+					return !m_Proxies[interval.id].alive;
+				}),
+			m_Intervals.end()
+		);
+		m_FreeList.insert(m_FreeList.end(), m_PendingFree.begin(), m_PendingFree.end());
+		m_PendingFree.clear();
+	}
+
+	for (ProxyId id : m_Added)
+	{
+		if (m_Proxies[id].alive)
+			m_Intervals.push_back({ 0, 0, 0, 0, 0, 0, id });
+	}
+	m_Added.clear();
+
+	m_MaxWidth = 0;
+	for (Interval& interval : m_Intervals)
+	{
+		const Proxy& proxy = m_Proxies[interval.id];
+		interval.minX = proxy.bounds.x;
+		interval.maxX = proxy.bounds.x + proxy.bounds.width;
+		interval.minY = proxy.bounds.y;
+		interval.maxY = proxy.bounds.y + proxy.bounds.height;
+		interval.layer = proxy.layer;
+		interval.mask = proxy.mask;
+		m_MaxWidth = std::max(m_MaxWidth, proxy.bounds.width);
+	}
+	Sort();
+}
+
+/**
+ * @brief Restores the minX order with an insertion sort.
+ *
+ * Last tick's order is the starting point, so with small motion each element moves
+ * at most a few slots and the whole pass is close to linear.
+ */
+void SweepAndPrune::Sort()
+{
+	const size_t count = m_Intervals.size();
+	for (size_t i = 1; i < count; i++)
+	{
+		Interval key = m_Intervals[i];
+		size_t j = i;
+		while (j > 0 && m_Intervals[j - 1].minX > key.minX)
+		{
+			m_Intervals[j] = m_Intervals[j - 1];
+			j--;
+		}
+		m_Intervals[j] = key;
+	}
+}
+
+/**
+ * @brief Reports overlapping, layer-compatible pairs.
+ *
+ * After the incremental sort each interval is swept forward only while the next
+ * interval starts before it ends on X. Candidates are then rejected by the
+ * layer/mask filter (one AND) before the Y overlap test.
+ *
+ * @param pairs Output list; pairs are appended.
+ */
+void SweepAndPrune::QueryPairs(std::vector<BroadphasePair>& pairs)
+{
+	Refresh();
+
+	const size_t count = m_Intervals.size();
+	for (size_t i = 0; i < count; i++)
+	{
+		const Interval& a = m_Intervals[i];
+		for (size_t j = i + 1; j < count && m_Intervals[j].minX <= a.maxX; j++)
+		{
+			const Interval& b = m_Intervals[j];
+			if (!((a.mask & b.layer) | (b.mask & a.layer)))
+				continue;
+			if (a.maxY < b.minY || b.maxY < a.minY)
+				continue;
+
+			pairs.push_back({ m_Proxies[a.id].userData, m_Proxies[b.id].userData });
+		}
+	}
+}
+
+
+/**
+ * @brief Reports every proxy overlapping a region.
+ *
+ * Brings the sorted list up to date like QueryPairs, then binary-searches the first
+ * interval that could reach the region (minX no further left than the widest interval)
+ * and walks forward until intervals start past its right edge.
+ *
+ * @param region World-space rectangle to test.
+ * @param out Output list; userData pointers are appended.
+ */
+void SweepAndPrune::QueryRegion(const Rectangle& region, std::vector<void*>& out)
+{
+	Refresh();
+
+	const float minX = region.x, maxX = region.x + region.width;
+	const float minY = region.y, maxY = region.y + region.height;
+	auto it = std::lower_bound(m_Intervals.begin(), m_Intervals.end(), minX - m_MaxWidth,
+		[](const Interval& interval, float x) { return interval.minX < x; });
+	for (; it != m_Intervals.end() && it->minX <= maxX; ++it)
+	{
+		if (it->maxX < minX || it->maxY < minY || maxY < it->minY)
+			continue;
+		out.push_back(m_Proxies[it->id].userData);
+	}
+}
+
+/**
+ * @brief Reports up to `limit` proxies on `layers` overlapping a region, nearest centre first.
+ *
+ * Binary-searches the region's centre in the sorted list and walks outwards from it,
+ * NearbyChunk intervals at a time, always on the side whose next interval may have its
+ * centre closer on X: on the right that is at least its minX past the centre; on the
+ * left, since the list is sorted by minX, half a widest interval less than its minX
+ * before it. Each run of intervals is filtered without branches, and the matches are
+ * insertion-sorted into the best `limit` by squared distance between centres (then by
+ * ProxyId). The walk stops once both sides' bounds on X exceed the worst of a full
+ * list, so a dense crowd only walks the band its nearest results span. As in
+ * QueryRegion, the right walk also ends past the region's right edge and the left walk
+ * a widest interval before its left edge.
+ *
+ * @param region World-space rectangle to search.
+ * @param layers CollisionLayer bits to accept.
+ * @param limit Maximum number of results.
+ * @param out Output list; userData pointers are appended.
+ */
+void SweepAndPrune::QueryNearby(const Rectangle& region, uint32_t layers, size_t limit, std::vector<void*>& out)
+{
+	if (limit == 0) return;
+	Refresh();
+
+	const float minX = region.x, maxX = region.x + region.width;
+	const float minY = region.y, maxY = region.y + region.height;
+	const float centerX = minX + region.width * 0.5f;
+	const float centerY = minY + region.height * 0.5f;
+	const float lowest = minX - m_MaxWidth;
+	const float halfWidest = m_MaxWidth * 0.5f;
+	const auto byMinX = [](const Interval& interval, float x) { return interval.minX < x; };
+	const size_t leftEnd = static_cast<size_t>(std::lower_bound(m_Intervals.begin(), m_Intervals.end(), lowest, byMinX) - m_Intervals.begin());
+	size_t right = static_cast<size_t>(std::lower_bound(m_Intervals.begin() + leftEnd, m_Intervals.end(), centerX, byMinX) - m_Intervals.begin());
+	const size_t rightEnd = static_cast<size_t>(std::upper_bound(m_Intervals.begin() + right, m_Intervals.end(), maxX,
+		[](float x, const Interval& interval) { return x < interval.minX; }) - m_Intervals.begin());
+	size_t left = right; // Next on the left is left - 1
+
+	// Sorted ascending, at most `limit` long; worst is the squared distance a new result must beat
+	m_Nearest.clear();
+	float worst = std::numeric_limits<float>::infinity();
+	float distances[NearbyChunk];
+	ProxyId ids[NearbyChunk];
+	const auto scan = [&](size_t first, size_t end) {
+		// Branch-free filter of a run of intervals, then insert the few that match
+		size_t matches = 0;
+		for (size_t i = first; i < end; i++)
+		{
+			const Interval& interval = m_Intervals[i];
+			const bool overlaps = ((interval.layer & layers) != 0) & (interval.maxX >= minX)
+				& (interval.maxY >= minY) & (interval.minY <= maxY);
+			const float dx = (interval.minX + interval.maxX) * 0.5f - centerX;
+			const float dy = (interval.minY + interval.maxY) * 0.5f - centerY;
+			distances[matches] = dx * dx + dy * dy;
+			ids[matches] = interval.id;
+			matches += overlaps;
+		}
+		for (size_t m = 0; m < matches; m++)
+		{
+			const std::pair<float, ProxyId> candidate = { distances[m], ids[m] };
+			if (m_Nearest.size() < limit)
+				m_Nearest.push_back(candidate);
+			else if (candidate < m_Nearest.back())
+				m_Nearest.back() = candidate;
+			else
+				continue;
+			for (size_t i = m_Nearest.size() - 1; i > 0 && m_Nearest[i] < m_Nearest[i - 1]; i--)
+				std::swap(m_Nearest[i], m_Nearest[i - 1]);
+		}
+		if (m_Nearest.size() == limit)
+			worst = m_Nearest.back().first;
+	};
+
+	constexpr float Closed = std::numeric_limits<float>::infinity();
+	for (;;)
+	{
+		// Lower bounds on how far the next interval's centre is from ours on X
+		const float rightGap = right < rightEnd ? m_Intervals[right].minX - centerX : Closed;
+		const float leftGap = left > leftEnd ? std::max(0.f, centerX - halfWidest - m_Intervals[left - 1].minX) : Closed;
+		const float gap = std::min(rightGap, leftGap);
+		if (gap == Closed || gap * gap > worst)
+			break;
+
+		if (rightGap <= leftGap)
+		{
+			const size_t end = std::min(right + NearbyChunk, rightEnd);
+			scan(right, end);
+			right = end;
+		}
+		else
+		{
+			const size_t first = left - std::min(NearbyChunk, left - leftEnd);
+			scan(first, left);
+			left = first;
+		}
+	}
+
+	for (const auto& nearest : m_Nearest)
+		out.push_back(m_Proxies[nearest.second].userData);
+}
@@ -0,0 +1,108 @@
+#include "Render/Animation.h"
+#include "NPCs/Entity.h"
+
+std::vector<AnimationClip> AnimationLibrary::s_Clips;
+std::vector<Rectangle> AnimationLibrary::s_Frames;
+std::vector<Animator> AnimationStore::s_Animators;
+std::vector<Entity*> AnimationStore::s_Owners;
+
+/**
+ * @brief Cuts a clip out of a sprite sheet and appends its frames to the frame table.
+ *
+ * @param texture Sprite sheet the frames are on.
+ * @param firstFrame Source rectangle of the first frame.
+ * @param frameCount Number of frames, laid out left to right.
+ * @param ticksPerFrame Ticks each frame is shown; at least one.
+ * @param loop Whether the clip wraps.
+ * @return Handle of the new clip.
+ */
+ClipId AnimationLibrary::AddClip(TextureId texture, const Rectangle& firstFrame, uint16_t frameCount, uint16_t ticksPerFrame, bool loop)
+{
+	const uint32_t first = static_cast<uint32_t>(s_Frames.size());
+	for (uint16_t i = 0; i < frameCount; i++)
+		s_Frames.push_back({ firstFrame.x + firstFrame.width * i, firstFrame.y, firstFrame.width, firstFrame.height });
+
+	s_Clips.push_back({ texture, first, frameCount, static_cast<uint16_t>(ticksPerFrame > 0 ? ticksPerFrame : 1), loop });
+	return static_cast<ClipId>(s_Clips.size() - 1);
+}
+
+/**
+ * @brief Loads a texture and splits it into equal frames across its width.
+ *
+ * A single image is a strip of one frame.
+ *
+ * @param path Texture file.
+ * @param frameCount Number of frames across the texture.
+ * @param ticksPerFrame Ticks each frame is shown.
+ * @param loop Whether the clip wraps.
+ * @return Handle of the new clip.
+ */
+ClipId AnimationLibrary::AddStrip(const char* path, uint16_t frameCount, uint16_t ticksPerFrame, bool loop)
+{
+	const TextureId texture = TextureCache::Load(path);
+	const Texture2D& sheet = TextureCache::Get(texture);
+	const float width = static_cast<float>(sheet.width) / frameCount;
+	return AddClip(texture, { 0, 0, width, static_cast<float>(sheet.height) }, frameCount, ticksPerFrame, loop);
+}
+
+/**
+ * @brief Adds an animator for a new entity, playing the set's idle clip.
+ *
+ * @param owner Entity that will own the animator.
+ * @param set Clips of the owner's archetype; must outlive the animator.
+ * @return Index of the animator; the owner must hand it back through Release.
+ */
+uint32_t AnimationStore::Allocate(Entity* owner, const AnimationSet& set)
+{
+	Animator animator{};
+	animator.set = &set;
+	animator.base = AnimState::Idle;
+	animator.Play(AnimState::Idle);
+
+	s_Animators.push_back(animator);
+	s_Owners.push_back(owner);
+	return static_cast<uint32_t>(s_Animators.size() - 1);
+}
+
+/**
+ * @brief Frees an animator.
+ *
+ * The last animator is moved into the freed slot and its owner's index is updated.
+ *
+ * @param index Index previously returned by Allocate.
+ */
+void AnimationStore::Release(uint32_t index)
+{
+	const uint32_t last = static_cast<uint32_t>(s_Animators.size() - 1);
+	if (index != last)
+	{
+		s_Animators[index] = s_Animators[last];
+		s_Owners[index] = s_Owners[last];
+		s_Owners[index]->m_AnimIndex = index;
+	}
+	s_Animators.pop_back();
+	s_Owners.pop_back();
+}
+
+/**
+ * @brief Advances every animator by one tick.
+ *
+ * A frame that has been up for its clip's ticksPerFrame moves on: looping clips wrap,
+ * and a finished one-shot hands over to the animator's looping base state.
+ */
+void AnimationStore::Advance()
+{
+	for (Animator& animator : s_Animators)
+	{
+		if (--animator.ticksLeft > 0) continue;
+
+		const AnimationClip& clip = AnimationLibrary::GetClip(animator.clip);
+		animator.ticksLeft = clip.ticksPerFrame;
+		if (animator.frame + 1 < clip.frameCount)
+			animator.frame++;
+		else if (clip.loop)
+			animator.frame = 0;
+		else if (animator.state != animator.base)
+			animator.Play(animator.base);
+	}
+}
@@ -0,0 +1,22 @@
+#include "Render/RenderSnapshot.h"
+
+/**
+ * @brief Submits every recorded sprite to raylib, in recording order.
+ *
+ * Sprites without a source rectangle draw their whole texture; animated entities
+ * record the frame rectangle of their clip.
+ *
+ * Must run on the thread that owns the window. Only reads the snapshot and the
+ * TextureCache, so the simulation can keep running while this draws.
+ */
+void RenderSnapshot::Draw() const
+{
+	for (const SpriteCommand& sprite : sprites)
+	{
+		const Texture2D& texture = TextureCache::Get(sprite.texture);
+		const Rectangle source = sprite.source.width > 0
+			? sprite.source
+			: Rectangle{ 0, 0, static_cast<float>(texture.width), static_cast<float>(texture.height) };
+		DrawTexturePro(texture, source, sprite.dest, { 0, 0 }, 0.f, WHITE);
+	}
+}
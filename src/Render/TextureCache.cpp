@@ -0,0 +1,48 @@
+#include "Render/TextureCache.h"
+
+std::vector<Texture2D> TextureCache::s_Textures;
+std::unordered_map<std::string, TextureId> TextureCache::s_Ids;
+bool TextureCache::s_Headless = false;
+
+/**
+ * @brief Returns the handle of a texture, loading it on first use.
+ *
+ * Creates a GPU resource, so it must be called from the window thread. Anything the
+ * simulation thread needs is loaded up front through the entity archetypes.
+ * In headless mode only the image is decoded, to learn its size; no GPU texture is made.
+ *
+ * @param path File path of the texture; also the cache key.
+ * @return Handle valid until UnloadAll.
+ */
+TextureId TextureCache::Load(const char* path)
+{
+	auto it = s_Ids.find(path);
+	if (it != s_Ids.end())
+		return it->second;
+
+	const TextureId id = static_cast<TextureId>(s_Textures.size());
+	if (s_Headless)
+	{
+		const Image image = LoadImage(path);
+		s_Textures.push_back({ 0, image.width, image.height, 1, image.format });
+		UnloadImage(image);
+	}
+	else
+		s_Textures.push_back(LoadTexture(path));
+	s_Ids.emplace(path, id);
+	return id;
+}
+
+/**
+ * @brief Releases every cached texture. Must run before the window closes.
+ */
+void TextureCache::UnloadAll()
+{
+	for (const Texture2D& texture : s_Textures)
+	{
+		if (texture.id != 0) // Headless placeholders own nothing
+			UnloadTexture(texture);
+	}
+	s_Textures.clear();
+	s_Ids.clear();
+}
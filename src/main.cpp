@@ -1,9 +1,16 @@
+#include <cstring>
+#include <cstdlib>
+
 #include "Game.h"
 
-int main()
+int main(int argc, char** argv)
 {
 	Game* game = new Game(1080, 1920, "Game");
-	game->run();
+	// --headless [ticks]: simulate without a window and print frame stats
+	if (argc > 1 && std::strcmp(argv[1], "--headless") == 0)
+		game->runHeadless(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 144 * 60);
+	else
+		game->run();
 
 	delete game;
 	return 0;
@@ -0,0 +1,55 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Core/FlightRecord.h"
+
+/**
+ * Prints a flight recorder dump as CSV, one row per tick.
+ *
+ * Usage: flightdecode <flight-N.bin>
+ */
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::fprintf(stderr, "usage: %s <flight dump>\n", argv[0]);
+		return 2;
+	}
+
+	std::FILE* file = std::fopen(argv[1], "rb");
+	if (!file)
+	{
+		std::fprintf(stderr, "couldn't open '%s'\n", argv[1]);
+		return 1;
+	}
+
+	FlightFileHeader header;
+	if (std::fread(&header, sizeof(header), 1, file) != 1
+		|| std::memcmp(header.magic, FlightMagic, sizeof(header.magic)) != 0
+		|| header.version != FlightVersion
+		|| header.recordSize != sizeof(TickRecord))
+	{
+		std::fprintf(stderr, "'%s' is not a version %u flight dump\n", argv[1], FlightVersion);
+		std::fclose(file);
+		return 1;
+	}
+
+	std::vector<TickRecord> records(header.count);
+	const size_t read = std::fread(records.data(), sizeof(TickRecord), records.size(), file);
+	std::fclose(file);
+	if (read != records.size())
+		std::fprintf(stderr, "truncated dump: %zu of %u records\n", read, header.count);
+
+	std::printf("# reason=%s tick_us=%u records=%zu\n",
+		header.reason == FlightDumpReason::Crash ? "crash" : "hitch", header.tickMicros, read);
+	std::printf("tick,dt_us,update_us,collision_us,allocations,entities,bullets,hits,input_down,fire_count\n");
+	for (size_t i = 0; i < read; i++)
+	{
+		const TickRecord& r = records[i];
+		std::printf("%llu,%u,%u,%u,%u,%u,%u,%u,0x%02x,%u\n",
+			static_cast<unsigned long long>(r.tick), r.dtMicros, r.updateMicros, r.collisionMicros,
+			r.allocations, r.entities, r.bullets, r.hits, r.inputDown, r.fireCount);
+	}
+	return 0;
+}